@@ -0,0 +1,48 @@
+#include "AllocCounter.h"
+
+static volatile TaskHandle_t countedTask = nullptr;
+static volatile uint32_t allocations = 0;
+static volatile bool wrapped = false;
+
+// Runs inside the allocator: no allocation, no logging, no locks
+static inline void countAllocation() {
+  wrapped = true;
+  if (countedTask != nullptr && xTaskGetCurrentTaskHandle() == countedTask) {
+    allocations++;  // Only the counted task writes it
+  }
+}
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+  countAllocation();
+  return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+  countAllocation();
+  return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+  countAllocation();
+  return __real_realloc(ptr, size);
+}
+}
+
+void AllocCounter::start() {
+  allocations = 0;
+  countedTask = xTaskGetCurrentTaskHandle();
+}
+
+uint32_t AllocCounter::stop() {
+  countedTask = nullptr;
+  return allocations;
+}
+
+bool AllocCounter::isWrapped() {
+  return wrapped;
+}
@@ -0,0 +1,23 @@
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <Arduino.h>
+
+// Heap allocations (malloc/calloc/realloc) made by one task in a window
+// The linker routes the C allocator through AllocCounter.cpp
+// (-Wl,--wrap=... in platformio.ini), so every allocation in the firmware
+// and the prebuilt libraries - operator new, String, ArduinoJson, lwIP -
+// passes the counter. Only the task that called start() is counted; other
+// tasks allocating at the same time do not disturb the count.
+// One window at a time (used by the /api/status heap check).
+class AllocCounter {
+public:
+  // Count the calling task's allocations from now on
+  static void start();
+  // Stop counting - returns the allocations since start()
+  static uint32_t stop();
+  // The allocator is wrapped (false if the linker flags are missing - counts stay 0)
+  static bool isWrapped();
+};
+
+#endif // ALLOC_COUNTER_H
@@ -3,21 +3,132 @@
 
 #include <M5Unified.h>
 #include <unit_audioplayer.hpp>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
 #include "config.h"
+#include "LatencyProbe.h"
 
 // AudioPlayer extends AudioPlayerUnit with custom methods
+//
+// The audio unit protocol waits for serial replies, so after begin() all UART
+// traffic goes through a dedicated FreeRTOS task fed by a bounded command
+// queue. Callers (loop() drop path, web handlers) only enqueue and return
+// immediately; the play status is polled by the task and cached.
 class AudioPlayer : public AudioPlayerUnit {
+public:
+  // Commands accepted by the audio task
+  enum CommandType : uint8_t {
+    CMD_PLAY
+  };
+
+  struct Command {
+    CommandType type;
+    uint16_t value;           // Track index
+    unsigned long queuedAt;   // millis() when enqueued (for timeout)
+    int64_t edgeMicros;       // Drop edge for latency measurement (0 = none)
+  };
+
 private:
   int txPin;
   int rxPin;
   bool initialized;
   
+  // Audio task and its command queue
+  QueueHandle_t commandQueue;
+  TaskHandle_t taskHandle;
+  
+  // Cached module state (written by the audio task only)
+  volatile uint8_t cachedPlayStatus;
+  volatile uint16_t totalFiles;
+  volatile uint16_t lastTrack;
+  
+  // Statistics
+  volatile unsigned long commandsSent;
+  volatile unsigned long commandsDropped;   // Queue full - oldest discarded
+  volatile unsigned long commandsExpired;   // Older than AUDIO_COMMAND_TIMEOUT
+  volatile unsigned long commandsFailed;    // Module error after all retries
+  
+  static const uint32_t TASK_STACK_SIZE = 4096;
+  static const UBaseType_t TASK_PRIORITY = 1;
+  static const BaseType_t TASK_CORE = 0;  // loop() runs on core 1
+  
+  static void taskEntry(void* param) {
+    static_cast<AudioPlayer*>(param)->taskLoop();
+  }
+  
+  // Audio task body - owns the UART after begin()
+  void taskLoop() {
+    Command cmd;
+    unsigned long lastPoll = 0;
+    
+    while (true) {
+      // Wait for a command, but wake up for the periodic status poll
+      if (xQueueReceive(commandQueue, &cmd, pdMS_TO_TICKS(AUDIO_STATUS_POLL_INTERVAL)) == pdTRUE) {
+        if (millis() - cmd.queuedAt > AUDIO_COMMAND_TIMEOUT) {
+          commandsExpired++;  // Stale - a late drop sound is worse than none
+          continue;
+        }
+        execute(cmd);
+      }
+      
+      if (millis() - lastPoll >= AUDIO_STATUS_POLL_INTERVAL) {
+        lastPoll = millis();
+        cachedPlayStatus = checkPlayStatus();
+      }
+    }
+  }
+  
+  // Run one command on the UART, retrying on module error
+  void execute(const Command& cmd) {
+    for (int attempt = 0; attempt <= AUDIO_COMMAND_RETRIES; attempt++) {
+      uint8_t result = 0;
+      switch (cmd.type) {
+        case CMD_PLAY:
+          result = playAudioByIndex(cmd.value);
+          lastTrack = cmd.value;
+          break;
+      }
+      if (result != AUDIO_PLAYER_STATUS_ERROR) {
+        commandsSent++;
+        if (cmd.type == CMD_PLAY) latencyProbe.recordAudio(cmd.edgeMicros);
+        return;
+      }
+    }
+    commandsFailed++;
+  }
+  
+  // Enqueue a command without blocking - drop the oldest one if full
+  bool post(CommandType type, uint16_t value = 0, int64_t edgeMicros = 0) {
+    if (!initialized || commandQueue == nullptr) return false;
+    
+    Command cmd = {type, value, millis(), edgeMicros};
+    if (xQueueSend(commandQueue, &cmd, 0) == pdTRUE) {
+      return true;
+    }
+    
+    Command oldest;
+    if (xQueueReceive(commandQueue, &oldest, 0) == pdTRUE) {
+      commandsDropped++;
+    }
+    return xQueueSend(commandQueue, &cmd, 0) == pdTRUE;
+  }
+  
 public:
   // Constructor - pins will be set via begin()
   AudioPlayer() 
     : txPin(-1),
       rxPin(-1),
-      initialized(false) {
+      initialized(false),
+      commandQueue(nullptr),
+      taskHandle(nullptr),
+      cachedPlayStatus(AUDIO_PLAYER_STATUS_ERROR),
+      totalFiles(AUDIO_PLAYER_STATUS_ERROR),
+      lastTrack(0),
+      commandsSent(0),
+      commandsDropped(0),
+      commandsExpired(0),
+      commandsFailed(0) {
   }
   
   // Initialize the audio player using M5.getPin() for Grove Port A
@@ -31,19 +142,52 @@ public:
     bool success = AudioPlayerUnit::begin(&Serial1, port_a_pin1, port_a_pin2);
     
     if (success) {
+      // Synchronous setup before the audio task takes over the UART
       setVolume(AUDIO_PLAYER_VOLUME);
       delay(100);
+      totalFiles = getTotalAudioNumber();
+      
+      commandQueue = xQueueCreate(AUDIO_QUEUE_LENGTH, sizeof(Command));
+      if (commandQueue == nullptr ||
+          xTaskCreatePinnedToCore(taskEntry, "audio", TASK_STACK_SIZE, this,
+                                  TASK_PRIORITY, &taskHandle, TASK_CORE) != pdPASS) {
+        Serial.println("Audio task creation failed");
+        return false;
+      }
       initialized = true;
     }
     return success;
   }
   
   // Play drop sound effect (assumes track 1 is the drop sound)
-  void playDropSound() {
+  // Non-blocking: queued for the audio task
+  // edgeMicros: optical edge of the drop, for latency measurement (0 = none)
+  void playDropSound(int64_t edgeMicros = 0) {
     if (!initialized) return;  // Gracefully fail if hardware not available
-    playAudioByIndex(DROP_SOUND_TRACK);
+    post(CMD_PLAY, DROP_SOUND_TRACK, edgeMicros);
   }
   
+  // Cached play status (never touches the UART)
+  uint8_t getPlayStatus() const {
+    return cachedPlayStatus;
+  }
+  
+  // Cached file count (read once in begin())
+  uint16_t getFileCount() const {
+    return totalFiles;
+  }
+  
+  // Last track sent to the module
+  uint16_t getLastTrack() const {
+    return lastTrack;
+  }
+  
+  // Queue statistics
+  unsigned long getCommandsSent() const { return commandsSent; }
+  unsigned long getCommandsDropped() const { return commandsDropped; }
+  unsigned long getCommandsExpired() const { return commandsExpired; }
+  unsigned long getCommandsFailed() const { return commandsFailed; }
+  
   // Check if hardware is working
   bool isInitialized() const {
     return initialized;
@@ -51,7 +195,6 @@ public:
   
   // List available audio files
   void listFiles() {
-    uint16_t totalFiles = getTotalAudioNumber();
     
     M5.Display.fillScreen(BLACK);
     M5.Display.setTextSize(1.4);
@@ -95,9 +238,8 @@ public:
               playDropSound();
               playCount++;
               
-              // Get current file info
-              uint16_t currentFile = getCurrentAudioNumber();
-              uint16_t totalFiles = getTotalAudioNumber();
+              // Get current file info (cached - the audio task owns the UART)
+              uint16_t currentFile = DROP_SOUND_TRACK;
               
               M5.Display.fillScreen(BLACK);
               M5.Display.setTextColor(WHITE, RED);
@@ -113,7 +255,7 @@ public:
               M5.Display.setTextSize(1.5);
               M5.Display.setCursor(10, 70);
               M5.Display.setTextColor(WHITE, BLACK);
-              if (currentFile != AUDIO_PLAYER_STATUS_ERROR) {
+              if (totalFiles != AUDIO_PLAYER_STATUS_ERROR) {
                 M5.Display.printf("File: %d/%d", currentFile, totalFiles);
               } else {
                 M5.Display.println("File: ?/?");
@@ -125,7 +267,8 @@ public:
               M5.Display.printf("Count: %d", playCount);
               
               // Wait for playback to finish
-              while (checkPlayStatus() == AUDIO_PLAYER_STATUS_PLAYING)
+              delay(AUDIO_STATUS_POLL_INTERVAL);  // Let the task refresh the cached status
+              while (getPlayStatus() == AUDIO_PLAYER_STATUS_PLAYING)
               {
                   M5.update();
                   if (M5.BtnA.wasPressed())
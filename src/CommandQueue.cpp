@@ -0,0 +1,4 @@
+#include "CommandQueue.h"
+
+// Global instance
+CommandQueue commandQueue;
@@ -0,0 +1,233 @@
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include "config.h"
+
+// Commands from the web handlers to the control loop
+//
+// ESPAsyncWebServer handlers run on the async_tcp task while loop() owns the
+// thermostat, LEDs, audio, drop counter and settings. Handlers therefore only
+// post a typed command into a bounded queue (never blocking) and get back a
+// reply ID. loop() drains the queue, executes each command and stores its
+// JSON reply under that ID; the handler's deferred response (or a later
+// GET /api/command?id=) picks the reply up.
+class CommandQueue {
+public:
+  enum CommandType : uint8_t {
+    CMD_DROP,              // Simulated drop (same as the LCD button)
+    CMD_TOGGLE_PELTIER,
+    CMD_TEST_PELTIER,
+    CMD_TEST_LED,
+    CMD_TEST_AUDIO,
+    CMD_TOGGLE_SYSTEM,
+    CMD_RESET,             // Reset settings to defaults and restart
+    CMD_UPDATE,            // Apply a SettingsUpdate
+    CMD_UPDATE_BATCH,      // Apply a validated SettingsUpdate - all or nothing, per-field reply
+    CMD_UPSERT_STATION,    // Add or update a station (StationUpdate)
+    CMD_DELETE_STATION,    // Remove a station (keeps a linked setpoint consistent)
+    CMD_RESTART            // Restart (after a firmware update)
+  };
+
+  // Fields present in a SettingsUpdate
+  enum UpdateField : uint16_t {
+    FIELD_SETPOINT_MODE      = 1 << 0,
+    FIELD_MANUAL_SETPOINT    = 1 << 1,
+    FIELD_REACTIVATE_TEMP    = 1 << 2,
+    FIELD_FREEZE_DURATION    = 1 << 3,
+    FIELD_REACTIVATE_TIMER   = 1 << 4,
+    FIELD_LED_FADE_TIME      = 1 << 5,
+    FIELD_LED_BRIGHTNESS     = 1 << 6,
+    FIELD_CUBE_LIGHT         = 1 << 7,
+    FIELD_CUBE_BRIGHTNESS    = 1 << 8,
+    NUM_UPDATE_FIELDS        = 9
+  };
+
+  // Parameter name of a field (same in /api/update and /api/settings)
+  static const char* fieldName(uint16_t field) {
+    switch (field) {
+      case FIELD_SETPOINT_MODE:    return "setpointMode";
+      case FIELD_MANUAL_SETPOINT:  return "manualSetpoint";
+      case FIELD_REACTIVATE_TEMP:  return "reactivateTemp";
+      case FIELD_FREEZE_DURATION:  return "freezeDuration";
+      case FIELD_REACTIVATE_TIMER: return "reactivateTimer";
+      case FIELD_LED_FADE_TIME:    return "ledFadeTime";
+      case FIELD_LED_BRIGHTNESS:   return "ledBrightness";
+      case FIELD_CUBE_LIGHT:       return "cubeLight";
+      case FIELD_CUBE_BRIGHTNESS:  return "cubeLightBrightness";
+      default:                     return "?";
+    }
+  }
+
+  // Parameter changes from /api/update and /api/settings (only the flagged
+  // fields apply)
+  struct SettingsUpdate {
+    uint16_t fields;
+    int setpointMode;
+    float manualSetpoint;
+    float reactivateTemp;
+    uint32_t freezeDuration;     // ms
+    uint32_t reactivateTimer;    // ms
+    uint16_t ledFadeTime;        // ms
+    uint8_t ledBrightness;
+    bool cubeLight;
+    uint8_t cubeLightBrightness;
+  };
+
+  // Fields present in a StationUpdate
+  enum StationField : uint8_t {
+    STATION_NAME             = 1 << 0,
+    STATION_TIMEZONE         = 1 << 1,
+    STATION_LOCATION         = 1 << 2,  // lat and lon
+    STATION_INTERVAL         = 1 << 3,
+    STATION_PRIORITY         = 1 << 4,
+    STATION_DISPLAYED        = 1 << 5,
+    STATION_LOCAL            = 1 << 6
+  };
+
+  // Station add/update from /api/stations (only the flagged fields apply;
+  // values are range-checked by the handler)
+  struct StationUpdate {
+    uint8_t fields;
+    int8_t index;                // -1 = add
+    char name[WEATHER_STATION_NAME_LEN];
+    char timezone[WEATHER_STATION_TZ_LEN];
+    float lat;
+    float lon;
+    uint32_t fetchInterval;      // ms (0 = WEATHER_UPDATE_INTERVAL)
+    uint8_t priority;
+    bool displayed;
+    bool local;
+  };
+
+  struct Command {
+    uint32_t id;
+    CommandType type;
+    int32_t arg;                 // Station index for CMD_DELETE_STATION
+    union {
+      SettingsUpdate update;     // CMD_UPDATE, CMD_UPDATE_BATCH
+      StationUpdate station;     // CMD_UPSERT_STATION
+    };
+  };
+
+  // Lookup result for a reply ID
+  enum ReplyState {
+    REPLY_PENDING,               // Queued or executing
+    REPLY_READY,
+    REPLY_UNKNOWN                // Never issued, or overwritten by newer commands
+  };
+
+private:
+  struct Reply {
+    uint32_t id;
+    bool done;
+    char body[COMMAND_REPLY_SIZE];
+  };
+
+  QueueHandle_t queue;
+  Reply replies[COMMAND_REPLY_SLOTS];  // Slot = id % COMMAND_REPLY_SLOTS
+  uint32_t nextId;
+  portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;  // Replies: loop writes, web reads
+
+  // Statistics
+  volatile uint32_t commandsPosted;
+  volatile uint32_t commandsRejected;  // Queue full
+  volatile uint32_t commandsExecuted;
+
+public:
+  CommandQueue()
+    : queue(nullptr),
+      nextId(1),
+      commandsPosted(0),
+      commandsRejected(0),
+      commandsExecuted(0) {
+    memset(replies, 0, sizeof(replies));
+  }
+
+  // Create the queue (call from setup() before the web server starts)
+  bool begin() {
+    if (queue == nullptr) {
+      queue = xQueueCreate(COMMAND_QUEUE_LENGTH, sizeof(Command));
+    }
+    return queue != nullptr;
+  }
+
+  // Post a command (web handlers) - never blocks
+  // Assigns cmd.id and returns it, or 0 if the queue is full.
+  uint32_t post(Command& cmd) {
+    if (queue == nullptr) return 0;
+
+    portENTER_CRITICAL(&lock);
+    uint32_t id = nextId++;
+    if (nextId == 0) nextId = 1;  // 0 means "rejected"
+    Reply& reply = replies[id % COMMAND_REPLY_SLOTS];
+    reply.id = id;
+    reply.done = false;
+    reply.body[0] = '\0';
+    portEXIT_CRITICAL(&lock);
+
+    cmd.id = id;
+    if (xQueueSend(queue, &cmd, 0) != pdTRUE) {
+      commandsRejected++;
+      portENTER_CRITICAL(&lock);
+      if (reply.id == id) reply.id = 0;
+      portEXIT_CRITICAL(&lock);
+      return 0;
+    }
+    commandsPosted++;
+    return id;
+  }
+
+  // Take the next command (loop() only) - never blocks
+  bool receive(Command& cmd) {
+    return queue != nullptr && xQueueReceive(queue, &cmd, 0) == pdTRUE;
+  }
+
+  // Store the JSON reply of an executed command (loop() only)
+  void complete(uint32_t id, const char* body) {
+    portENTER_CRITICAL(&lock);
+    Reply& reply = replies[id % COMMAND_REPLY_SLOTS];
+    if (reply.id == id) {
+      strncpy(reply.body, body, sizeof(reply.body) - 1);
+      reply.body[sizeof(reply.body) - 1] = '\0';
+      reply.done = true;
+    }
+    portEXIT_CRITICAL(&lock);
+    commandsExecuted++;
+  }
+
+  // Copy the reply for an ID into out (if ready and it fits)
+  // Sets length to the reply length when REPLY_READY.
+  ReplyState getReply(uint32_t id, char* out, size_t size, size_t& length) {
+    ReplyState state;
+    portENTER_CRITICAL(&lock);
+    const Reply& reply = replies[id % COMMAND_REPLY_SLOTS];
+    if (id == 0 || reply.id != id) {
+      state = REPLY_UNKNOWN;
+    } else if (!reply.done) {
+      state = REPLY_PENDING;
+    } else {
+      length = strlen(reply.body);
+      if (length < size) {
+        memcpy(out, reply.body, length + 1);
+        state = REPLY_READY;
+      } else {
+        state = REPLY_PENDING;  // Caller's buffer too small right now - retry
+      }
+    }
+    portEXIT_CRITICAL(&lock);
+    return state;
+  }
+
+  // Statistics
+  uint32_t getCommandsPosted() const { return commandsPosted; }
+  uint32_t getCommandsRejected() const { return commandsRejected; }
+  uint32_t getCommandsExecuted() const { return commandsExecuted; }
+};
+
+// Global instance
+extern CommandQueue commandQueue;
+
+#endif // COMMAND_QUEUE_H
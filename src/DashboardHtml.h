@@ -0,0 +1,384 @@
+// GENERATED by tools/embed_dashboard.py from web/index.html - do not edit.
+// Edit web/index.html instead; the header is regenerated on every build.
+#ifndef DASHBOARD_HTML_H
+#define DASHBOARD_HTML_H
+
+#include <Arduino.h>
+
+// ETag of the compressed page (changes whenever web/index.html changes)
+#define DASHBOARD_ETAG "\"c89fb8cde6f1d422\""
+
+// Uncompressed size: 23230 bytes
+const size_t DASHBOARD_HTML_GZ_LEN = 5882;
+const uint8_t DASHBOARD_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x3c, 0xdb, 0x76, 0xdb, 0x38,
+  0x92, 0xef, 0xfe, 0x0a, 0xb4, 0x66, 0xa7, 0x45, 0x4e, 0xeb, 0x6e, 0xcb, 0xed, 0xd8, 0x96, 0x7b,
+  0xd3, 0x8e, 0xdd, 0xed, 0x99, 0xc4, 0xf1, 0x89, 0x9d, 0x9d, 0x33, 0x27, 0x9b, 0x33, 0xa1, 0x44,
+  0xc8, 0x62, 0x9b, 0x22, 0x78, 0x48, 0xca, 0xb2, 0xa6, 0xdb, 0x6f, 0xfb, 0xbe, 0x5f, 0xb0, 0xff,
+  0xb0, 0x8f, 0xfb, 0xbc, 0x9f, 0xb2, 0x3f, 0xb0, 0xbf, 0xb0, 0x55, 0x05, 0x90, 0x04, 0x78, 0x91,
+  0x64, 0x27, 0x99, 0x33, 0xdb, 0x4e, 0xdb, 0x12, 0x81, 0x2a, 0x14, 0xea, 0x86, 0xaa, 0x02, 0xc0,
+  0xe3, 0x6f, 0x5e, 0xbd, 0x3d, 0xbd, 0xf9, 0xcb, 0xd5, 0x19, 0x9b, 0x25, 0x73, 0xff, 0x64, 0xe7,
+  0x38, 0xfd, 0xc3, 0x1d, 0xf7, 0x64, 0x87, 0xb1, 0xe3, 0x39, 0x4f, 0x1c, 0x36, 0x99, 0x39, 0x51,
+  0xcc, 0x93, 0x51, 0xe3, 0xfd, 0xcd, 0x79, 0xfb, 0xa0, 0x91, 0x37, 0x04, 0xce, 0x9c, 0x8f, 0x1a,
+  0xf7, 0x1e, 0x5f, 0x86, 0x22, 0x4a, 0x1a, 0x6c, 0x22, 0x82, 0x84, 0x07, 0xd0, 0x71, 0xe9, 0xb9,
+  0xc9, 0x6c, 0xe4, 0xf2, 0x7b, 0x6f, 0xc2, 0xdb, 0xf4, 0xa5, 0xc5, 0xbc, 0xc0, 0x4b, 0x3c, 0xc7,
+  0x6f, 0xc7, 0x13, 0xc7, 0xe7, 0xa3, 0x7e, 0xa7, 0x27, 0x11, 0x25, 0x5e, 0xe2, 0xf3, 0x93, 0x57,
+  0x91, 0x17, 0x86, 0x5e, 0x70, 0xcb, 0xde, 0xf0, 0x84, 0x8b, 0xc8, 0x4b, 0xf8, 0x71, 0x57, 0xb6,
+  0x60, 0x9f, 0x38, 0x59, 0xc9, 0x4f, 0x8c, 0x8d, 0x85, 0xbb, 0x62, 0xbf, 0xd2, 0x47, 0xc6, 0xa6,
+  0x30, 0x5e, 0x7b, 0xea, 0xcc, 0x3d, 0x7f, 0x75, 0xc8, 0x5e, 0x46, 0x80, 0xbd, 0xc5, 0x62, 0x27,
+  0x88, 0xdb, 0x31, 0x8f, 0xbc, 0xe9, 0x91, 0xea, 0x35, 0x77, 0x1e, 0x24, 0x0d, 0x87, 0xec, 0xa0,
+  0xd7, 0x0b, 0x1f, 0xf2, 0xe7, 0xd1, 0xad, 0x17, 0x1c, 0xb2, 0x01, 0x3c, 0x63, 0xce, 0x22, 0x11,
+  0x69, 0x43, 0xe8, 0xb8, 0x2e, 0xd0, 0x22, 0x5b, 0xd2, 0x87, 0x63, 0x67, 0x72, 0x77, 0x1b, 0x89,
+  0x45, 0xe0, 0x1e, 0xb2, 0xdf, 0xf5, 0x1d, 0xfc, 0x49, 0x9b, 0x26, 0xc2, 0x17, 0x11, 0x3c, 0xe5,
+  0x3d, 0xfc, 0x91, 0x4f, 0x1f, 0xe9, 0xf7, 0xac, 0x9f, 0xd1, 0x9a, 0x76, 0xda, 0x73, 0x5e, 0xf0,
+  0x69, 0x46, 0x5b, 0xc2, 0x1f, 0x92, 0xb6, 0xe3, 0x7b, 0xb7, 0x40, 0xc7, 0x04, 0x58, 0xc7, 0xa3,
+  0x6c, 0x3c, 0x11, 0xb9, 0x3c, 0x6a, 0x8f, 0x45, 0x92, 0x88, 0x39, 0x90, 0x02, 0x34, 0xc6, 0xc2,
+  0xf7, 0xdc, 0x22, 0x06, 0x45, 0x6c, 0xd6, 0xb1, 0x9f, 0xd1, 0x2c, 0x49, 0xe8, 0x4c, 0x9c, 0xc8,
+  0xcd, 0xa8, 0x30, 0x66, 0x31, 0x70, 0xf0, 0xa7, 0x30, 0x60, 0xe4, 0xb8, 0xde, 0x22, 0x06, 0x56,
+  0xe5, 0x53, 0xaf, 0xe4, 0x87, 0xc1, 0xbd, 0x5e, 0x8e, 0xe4, 0xa1, 0x1d, 0xcf, 0x1c, 0x57, 0x2c,
+  0x0f, 0x59, 0x8f, 0xed, 0x41, 0xd3, 0x3e, 0xfc, 0x1f, 0xdd, 0x8e, 0x1d, 0xab, 0xd7, 0xa2, 0x9f,
+  0xce, 0xae, 0x6d, 0x90, 0x17, 0x27, 0x4e, 0xb2, 0x88, 0xdb, 0xb7, 0x91, 0x97, 0x53, 0xe9, 0x7a,
+  0x71, 0xe8, 0x3b, 0x20, 0x53, 0x7c, 0x9a, 0xa2, 0xc6, 0xcf, 0xed, 0x84, 0xcf, 0xa1, 0x25, 0xe1,
+  0x6d, 0x60, 0xe7, 0x62, 0x1e, 0x00, 0x9d, 0x11, 0x0f, 0xb9, 0x93, 0x58, 0x28, 0xbf, 0xf6, 0xd4,
+  0x4b, 0x5a, 0x6c, 0xee, 0x05, 0x20, 0x71, 0x6b, 0x80, 0xa2, 0x6e, 0xb1, 0xfe, 0x34, 0xb2, 0xed,
+  0x0c, 0x85, 0x13, 0x02, 0x83, 0x86, 0xeb, 0x27, 0x61, 0xd2, 0x05, 0x9a, 0x38, 0xaf, 0xe6, 0xde,
+  0xee, 0xee, 0x6e, 0x89, 0x41, 0x3a, 0xee, 0x02, 0x3f, 0xf7, 0x4b, 0x2d, 0x3e, 0x9f, 0x26, 0x87,
+  0xc4, 0xa3, 0x0a, 0xc1, 0x9a, 0x54, 0xf8, 0xce, 0x98, 0xfb, 0x25, 0x55, 0x7a, 0xf1, 0xe2, 0xc5,
+  0x91, 0x6e, 0x09, 0xb1, 0xf7, 0x37, 0x0e, 0x6c, 0xef, 0xbc, 0xe0, 0x73, 0x73, 0x82, 0x99, 0x72,
+  0x0c, 0x0b, 0xba, 0xa1, 0xd0, 0xdf, 0x3b, 0xfe, 0x82, 0x9b, 0x56, 0x25, 0x71, 0xf5, 0x3b, 0xc3,
+  0x1c, 0x17, 0x3d, 0x5f, 0x72, 0xef, 0x76, 0x06, 0x64, 0x8f, 0x85, 0xef, 0x1e, 0xad, 0x51, 0xed,
+  0x54, 0xf9, 0x00, 0x26, 0x12, 0x7e, 0x1b, 0xb9, 0x16, 0x66, 0x23, 0xa4, 0x6c, 0x47, 0x76, 0x99,
+  0x6c, 0x37, 0x27, 0x9a, 0xe9, 0xc1, 0xd8, 0x17, 0x93, 0xbb, 0x4d, 0x73, 0xca, 0x09, 0x19, 0x8f,
+  0xc7, 0x3a, 0x52, 0x2f, 0x08, 0x17, 0xc9, 0x87, 0x64, 0x15, 0x82, 0xb3, 0x0a, 0x16, 0xf3, 0x31,
+  0x8f, 0x1a, 0x1f, 0x5b, 0xc6, 0x53, 0x34, 0xc3, 0xc6, 0xc7, 0x6c, 0x5c, 0xe5, 0x2d, 0xfa, 0xbd,
+  0xde, 0xef, 0xcb, 0x22, 0xae, 0xf3, 0x09, 0x9a, 0x3e, 0x48, 0x01, 0x43, 0xdf, 0x5c, 0xb6, 0xc3,
+  0xe1, 0xb0, 0x46, 0x31, 0xf6, 0xca, 0xf4, 0xeb, 0x8e, 0xc4, 0x94, 0x47, 0x2a, 0x0d, 0x39, 0xb1,
+  0x98, 0xfb, 0x7c, 0x92, 0xfc, 0xbf, 0x23, 0x7b, 0xbc, 0x00, 0xc9, 0x05, 0xd5, 0x56, 0x65, 0x3a,
+  0x37, 0x85, 0x79, 0x39, 0x03, 0x33, 0x2c, 0x52, 0x19, 0x88, 0x80, 0x97, 0xa7, 0x89, 0x7e, 0x72,
+  0xb0, 0x57, 0x6b, 0x85, 0x3a, 0xd5, 0x8b, 0x28, 0x46, 0xe4, 0xa1, 0xf0, 0x74, 0xbf, 0x5b, 0x45,
+  0x76, 0xae, 0xb1, 0x05, 0x03, 0x92, 0x33, 0x39, 0x9c, 0x89, 0x7b, 0x1e, 0xd5, 0x78, 0x09, 0xe7,
+  0x80, 0xbb, 0xd3, 0x0a, 0x18, 0x67, 0x92, 0x78, 0xf7, 0xbc, 0xce, 0x31, 0x7f, 0xcf, 0x27, 0xa6,
+  0x21, 0x2d, 0xc1, 0xc9, 0xcd, 0x60, 0x22, 0x5f, 0xdc, 0x4f, 0xf6, 0x0f, 0xea, 0xfc, 0x64, 0x71,
+  0x21, 0x49, 0x49, 0x78, 0xa2, 0x4b, 0xec, 0x6d, 0x23, 0x8c, 0xba, 0x75, 0xb0, 0x30, 0x34, 0x06,
+  0x1c, 0xa6, 0x9f, 0xda, 0xd6, 0x1f, 0x6d, 0x74, 0x85, 0xa8, 0x90, 0x39, 0x24, 0xc0, 0xed, 0x39,
+  0x47, 0x59, 0xdb, 0x74, 0xaa, 0x35, 0x62, 0x93, 0xd6, 0x38, 0x5b, 0xb6, 0xa5, 0x1b, 0xfd, 0xb2,
+  0x62, 0x19, 0x6e, 0x2b, 0x16, 0x18, 0xff, 0x6b, 0x48, 0x24, 0x9b, 0xc4, 0xd4, 0xe7, 0xd9, 0xc3,
+  0x5f, 0x16, 0x71, 0xe2, 0x4d, 0x57, 0x6d, 0x15, 0xe8, 0x1d, 0xb2, 0x38, 0x74, 0x20, 0xc2, 0x1b,
+  0xf3, 0x64, 0xc9, 0x79, 0x90, 0xf6, 0x22, 0x39, 0x12, 0x51, 0x71, 0xa5, 0x34, 0x81, 0x62, 0x71,
+  0x57, 0xc1, 0xed, 0xb2, 0x40, 0x35, 0x88, 0xa9, 0xe3, 0xf9, 0x15, 0x42, 0x58, 0x0b, 0xb3, 0x74,
+  0xa2, 0xc0, 0x80, 0x71, 0xd6, 0xc1, 0x1c, 0x77, 0x55, 0x9c, 0x79, 0xdc, 0x95, 0xf1, 0xef, 0x31,
+  0x06, 0x9b, 0x14, 0x80, 0xce, 0xfa, 0x27, 0xff, 0xf3, 0x1f, 0xff, 0xf6, 0xbf, 0xff, 0xf5, 0xef,
+  0x10, 0x9f, 0xfa, 0x09, 0xc6, 0xa9, 0x3f, 0xf9, 0xce, 0xc4, 0xe3, 0x51, 0xcc, 0x4e, 0x71, 0x69,
+  0x62, 0xb2, 0x15, 0x00, 0xfb, 0xd8, 0x1f, 0x41, 0x5c, 0xef, 0x9e, 0x4d, 0x7c, 0x27, 0x8e, 0x47,
+  0x0d, 0x8c, 0xc0, 0x1a, 0x8c, 0x90, 0x8f, 0x1a, 0xa6, 0xa1, 0x4f, 0x76, 0xf9, 0xb0, 0x77, 0xd4,
+  0x90, 0xb1, 0xed, 0xf1, 0x6c, 0x90, 0xf6, 0x2a, 0x28, 0x2b, 0x89, 0xac, 0x71, 0x72, 0xbd, 0x8a,
+  0x51, 0xd2, 0xa7, 0x72, 0x51, 0x85, 0xd1, 0x06, 0x0a, 0x50, 0x79, 0x54, 0xcf, 0x1d, 0x35, 0x62,
+  0xea, 0xd3, 0x4e, 0xc4, 0xed, 0xad, 0x0f, 0x92, 0x49, 0x82, 0x06, 0x13, 0xc1, 0xc4, 0xf7, 0x26,
+  0x77, 0xb0, 0xcc, 0xd1, 0x43, 0x89, 0xc5, 0xb2, 0x33, 0x92, 0x8c, 0x05, 0x7f, 0x00, 0x4e, 0xcf,
+  0x0c, 0x68, 0xd8, 0xae, 0x1a, 0xfd, 0x2f, 0xd7, 0x37, 0x67, 0x6f, 0x0e, 0xd9, 0xbb, 0xf7, 0x97,
+  0x97, 0x17, 0x97, 0x3f, 0x1d, 0x77, 0xe5, 0xa8, 0x8a, 0x84, 0xb0, 0x02, 0x9b, 0x0c, 0x45, 0x8c,
+  0x65, 0x39, 0x35, 0xc3, 0x44, 0x84, 0xd9, 0xb4, 0xae, 0x9c, 0x45, 0xcc, 0xbb, 0x11, 0x8f, 0x17,
+  0x60, 0xdd, 0x68, 0xe7, 0x73, 0x81, 0x16, 0xc5, 0x9c, 0xc0, 0x85, 0x25, 0x2e, 0x00, 0x2f, 0xcd,
+  0x16, 0xa1, 0x0b, 0x66, 0x13, 0x1f, 0x77, 0x43, 0x92, 0x47, 0x17, 0xb8, 0x5b, 0xc7, 0xe8, 0x8c,
+  0x97, 0x27, 0x3f, 0xc3, 0x57, 0x50, 0x01, 0xce, 0xae, 0xc9, 0x3e, 0x35, 0x7e, 0x69, 0x30, 0x99,
+  0xf9, 0x2a, 0xc0, 0x52, 0x2b, 0xea, 0x71, 0xd6, 0x86, 0xc9, 0x48, 0xe8, 0x04, 0x27, 0x37, 0x60,
+  0xc8, 0x3c, 0x02, 0x30, 0xc4, 0x4e, 0x24, 0x82, 0xf6, 0x60, 0x83, 0xd9, 0x8f, 0x24, 0x02, 0x38,
+  0xd0, 0xee, 0x1b, 0x1a, 0x4e, 0x71, 0xd7, 0x38, 0x79, 0xfb, 0x27, 0x13, 0x24, 0x9b, 0xd4, 0xb6,
+  0x34, 0xbc, 0x8a, 0x44, 0xc8, 0x5e, 0x41, 0xbe, 0x34, 0x49, 0x36, 0x0c, 0xef, 0x42, 0xcf, 0x2f,
+  0x3e, 0xfc, 0x25, 0x17, 0x57, 0xde, 0x03, 0xf7, 0xe3, 0xb5, 0x43, 0x07, 0x5c, 0x7c, 0xf1, 0x91,
+  0x5f, 0x2e, 0x5c, 0x4f, 0xb0, 0x2b, 0xf0, 0x4e, 0x7c, 0xfd, 0xbc, 0x1d, 0xec, 0xf8, 0xc5, 0x87,
+  0xff, 0xb3, 0x77, 0xee, 0x91, 0x4a, 0x79, 0x22, 0x58, 0x3b, 0xfc, 0xd2, 0x9b, 0x7a, 0xfa, 0xe8,
+  0xe8, 0x8e, 0x1a, 0x27, 0x97, 0xdd, 0x97, 0x9f, 0x4b, 0x00, 0x1f, 0x83, 0xd2, 0x45, 0xf7, 0x1b,
+  0x66, 0xbf, 0xe4, 0xe3, 0x27, 0xcc, 0x3d, 0xfb, 0xb8, 0xa5, 0x71, 0x29, 0x5f, 0xb4, 0xce, 0xb4,
+  0xb4, 0xd4, 0xae, 0xd2, 0xb8, 0xb4, 0x14, 0x4b, 0x9f, 0x63, 0xb9, 0x07, 0x65, 0x05, 0x8d, 0x93,
+  0x9b, 0xcc, 0x35, 0x18, 0x2c, 0xab, 0x04, 0xa1, 0x94, 0xa6, 0x41, 0xac, 0xc8, 0x3d, 0x0a, 0x59,
+  0x3a, 0x6f, 0x9c, 0xb4, 0xdb, 0x26, 0xcf, 0xeb, 0x04, 0xf0, 0x54, 0x02, 0xaf, 0x70, 0x71, 0x80,
+  0x48, 0x10, 0xbd, 0xc3, 0x93, 0x48, 0x0c, 0x25, 0xa0, 0xf4, 0x13, 0x40, 0xde, 0x7f, 0xff, 0xe7,
+  0xe9, 0xd7, 0xa1, 0xf0, 0x9a, 0x27, 0x14, 0xef, 0x3e, 0x89, 0xba, 0x58, 0x01, 0x7d, 0x55, 0xca,
+  0xc8, 0x9b, 0x9d, 0xc2, 0xba, 0xf8, 0x34, 0xda, 0xd0, 0xb5, 0x41, 0x38, 0xb2, 0x90, 0xd4, 0xd5,
+  0x91, 0xf6, 0x54, 0xe5, 0xfe, 0xd9, 0x8b, 0xc1, 0xa7, 0xae, 0x34, 0xb5, 0x56, 0xa9, 0x16, 0x99,
+  0x96, 0x6c, 0x84, 0xa0, 0x29, 0xb8, 0xe5, 0xb4, 0xba, 0xce, 0xf0, 0xd3, 0xa8, 0xe1, 0x0b, 0xc7,
+  0x55, 0x90, 0xb0, 0xba, 0x66, 0x64, 0x88, 0x10, 0x3d, 0x05, 0x23, 0xa2, 0x47, 0x8d, 0x41, 0x7f,
+  0xbf, 0xd7, 0x6b, 0x9c, 0xbc, 0x76, 0xe2, 0x84, 0xed, 0xb3, 0x99, 0x80, 0x2c, 0xe4, 0xb8, 0x2b,
+  0xbb, 0xd4, 0x40, 0x1c, 0xec, 0xef, 0x01, 0x84, 0x4a, 0xf6, 0xb8, 0x2b, 0x41, 0x07, 0x7b, 0x5b,
+  0xc1, 0xee, 0xf7, 0xf6, 0x0e, 0xb2, 0xe1, 0xbe, 0x67, 0xae, 0xb3, 0xda, 0x04, 0xb1, 0xbb, 0x3f,
+  0x38, 0x38, 0xd0, 0x28, 0x84, 0xc0, 0xee, 0xae, 0x00, 0x03, 0x3e, 0x84, 0x68, 0x51, 0xdf, 0x26,
+  0x4e, 0x70, 0xef, 0xc4, 0x06, 0x6b, 0xb0, 0x62, 0x98, 0x34, 0x64, 0x42, 0x3a, 0x6a, 0x7c, 0x3f,
+  0x00, 0xf2, 0x67, 0x14, 0x6f, 0xc1, 0xfc, 0x69, 0x2e, 0x32, 0x54, 0xd0, 0x13, 0xd6, 0xaa, 0xc0,
+  0xe0, 0xb8, 0x2b, 0x71, 0x6f, 0x1f, 0x62, 0xec, 0xef, 0xef, 0x63, 0x40, 0x81, 0x31, 0x36, 0x4b,
+  0xb4, 0x35, 0xda, 0x82, 0xb0, 0xba, 0x0b, 0x71, 0x35, 0x44, 0xc7, 0x81, 0x6b, 0xb7, 0x58, 0xaa,
+  0xd2, 0xcc, 0x12, 0x24, 0x46, 0x78, 0x94, 0x1a, 0xaf, 0xbb, 0x48, 0x56, 0xcc, 0x1a, 0x63, 0x45,
+  0x04, 0x2b, 0x59, 0x10, 0x06, 0x41, 0x23, 0xaa, 0x59, 0xcc, 0xac, 0x04, 0xc2, 0xa8, 0xd8, 0x7e,
+  0x5a, 0x14, 0xf2, 0x67, 0x99, 0xbb, 0xa4, 0x2b, 0x46, 0x8d, 0xaf, 0xd4, 0xf3, 0x3b, 0xa9, 0xd9,
+  0xc6, 0x93, 0x4c, 0x58, 0xdf, 0xb4, 0xdb, 0xec, 0x4a, 0x84, 0x0b, 0x9c, 0xa1, 0xcb, 0xc6, 0x2b,
+  0xf6, 0x47, 0xe7, 0xde, 0xb9, 0x9e, 0x44, 0x5e, 0x98, 0xb0, 0x76, 0xfb, 0x79, 0xda, 0xae, 0xe2,
+  0x49, 0x76, 0xe5, 0x44, 0x90, 0x5f, 0x41, 0xb4, 0x5e, 0x43, 0xa3, 0x51, 0xcc, 0xc9, 0x49, 0x22,
+  0x03, 0xce, 0x3c, 0x0b, 0x7b, 0x23, 0x5c, 0x7e, 0xdc, 0x95, 0x0f, 0xd3, 0x2e, 0x9a, 0xf5, 0xa4,
+  0x9c, 0x6f, 0xcf, 0xa1, 0x9f, 0x6e, 0x3d, 0x2a, 0x38, 0x55, 0xcd, 0x88, 0x45, 0x33, 0xa2, 0x92,
+  0x9a, 0xb6, 0xfb, 0x8d, 0x93, 0x37, 0x4e, 0xb0, 0x70, 0xfc, 0x92, 0x3e, 0x9b, 0xda, 0xa9, 0x39,
+  0x81, 0xda, 0xa9, 0x10, 0x61, 0x73, 0xc2, 0xd6, 0xce, 0xe8, 0xab, 0x9c, 0xa5, 0x1c, 0x92, 0x65,
+  0x93, 0xb5, 0xc0, 0x1f, 0xda, 0xc5, 0xd9, 0x52, 0x65, 0x89, 0x19, 0xf5, 0x26, 0xd0, 0x5c, 0x1e,
+  0x8e, 0x1a, 0xbd, 0xce, 0xb0, 0x72, 0xb0, 0x46, 0x36, 0xad, 0x5d, 0x55, 0x17, 0xdf, 0x92, 0xf2,
+  0x02, 0x79, 0xef, 0x38, 0x95, 0x15, 0x50, 0xfb, 0xf5, 0x08, 0xf5, 0xb9, 0x54, 0x46, 0x19, 0x3a,
+  0x15, 0xc1, 0xa6, 0x3e, 0xac, 0xf7, 0x59, 0x54, 0x9e, 0x47, 0x9c, 0xff, 0x0d, 0x93, 0xa8, 0x57,
+  0x8b, 0x88, 0x6c, 0x82, 0x59, 0x31, 0x07, 0x08, 0x37, 0x7e, 0x02, 0x91, 0x7d, 0x49, 0xe2, 0x14,
+  0x71, 0xf1, 0xb6, 0xab, 0x30, 0x65, 0x24, 0xf6, 0xbf, 0x14, 0x1b, 0xbd, 0x39, 0xd8, 0x2e, 0xba,
+  0x8f, 0x05, 0xe4, 0x1f, 0x4f, 0xa7, 0x4f, 0x67, 0x21, 0xa2, 0xca, 0x08, 0xdc, 0xfd, 0x1c, 0x02,
+  0x5f, 0x9f, 0xbd, 0x62, 0xe7, 0x8e, 0x2b, 0xc9, 0x7b, 0x0e, 0xf7, 0x7a, 0x1d, 0x45, 0x9f, 0xcf,
+  0x5d, 0x48, 0xad, 0x5d, 0x49, 0x5d, 0x46, 0xdc, 0xde, 0x67, 0xd2, 0xf6, 0x63, 0x84, 0xce, 0x3e,
+  0xe0, 0x31, 0xf8, 0xcc, 0x5e, 0x7b, 0x30, 0x1c, 0x6e, 0x45, 0x1a, 0x30, 0x19, 0x28, 0x6b, 0xe0,
+  0x86, 0x0d, 0xe8, 0xd8, 0x70, 0x98, 0x53, 0x38, 0xce, 0xf0, 0xe5, 0x3a, 0x08, 0xed, 0xcf, 0x27,
+  0xf2, 0x74, 0x31, 0xe6, 0xec, 0x35, 0x22, 0x65, 0xd6, 0xcb, 0xf9, 0xd8, 0xe3, 0x60, 0xcb, 0x3f,
+  0xf9, 0x62, 0x69, 0xaf, 0xf1, 0x5c, 0x13, 0x80, 0x69, 0xfb, 0x08, 0x53, 0xef, 0x96, 0xc0, 0x2b,
+  0xbd, 0xbd, 0x2c, 0x7a, 0xa4, 0x52, 0x2f, 0x10, 0xfd, 0xdb, 0xf3, 0xf3, 0x27, 0x39, 0xae, 0x7a,
+  0xfa, 0x9f, 0xc7, 0xeb, 0x6c, 0x42, 0x3a, 0x6b, 0xcb, 0x02, 0x48, 0x75, 0xb9, 0x4c, 0x93, 0x2a,
+  0x39, 0x64, 0xb5, 0x05, 0x99, 0xa1, 0xe7, 0x4b, 0x08, 0x3a, 0xef, 0xf7, 0xf4, 0xcc, 0x58, 0x57,
+  0x8c, 0x9a, 0x41, 0x11, 0x47, 0x02, 0xb4, 0xdc, 0xf2, 0x08, 0x43, 0x41, 0x04, 0xbf, 0xe1, 0x10,
+  0x81, 0xe0, 0x17, 0x1d, 0x6c, 0xcb, 0x35, 0x4d, 0x39, 0x6a, 0x44, 0x11, 0x57, 0x17, 0x4a, 0xb2,
+  0x98, 0xbb, 0xbe, 0x52, 0xa2, 0x42, 0x02, 0xa4, 0x45, 0x7d, 0x3c, 0x64, 0x24, 0xb8, 0xf5, 0xb3,
+  0x80, 0x31, 0xc1, 0x08, 0xb2, 0x19, 0xa0, 0x41, 0x58, 0x43, 0xb0, 0x51, 0x7b, 0x0b, 0x40, 0xca,
+  0x6d, 0x33, 0x50, 0xfa, 0xf6, 0x8c, 0xd9, 0xc3, 0xfa, 0x84, 0x55, 0xaa, 0x8a, 0x99, 0x67, 0x83,
+  0x45, 0x1c, 0x16, 0x9f, 0x1b, 0xf1, 0x8a, 0x4f, 0x9d, 0x85, 0x9f, 0xc4, 0x5a, 0x39, 0x28, 0xaf,
+  0x50, 0xb5, 0xd3, 0xb0, 0xca, 0x7d, 0x31, 0xdc, 0xdd, 0x9b, 0x42, 0x64, 0xf5, 0x0e, 0xa1, 0x58,
+  0x22, 0x58, 0x0a, 0xf7, 0xf4, 0x2a, 0x90, 0x0c, 0xd1, 0x00, 0x11, 0x44, 0x8a, 0x3c, 0x66, 0x8e,
+  0xef, 0x63, 0x34, 0x46, 0xe4, 0xb2, 0x69, 0x24, 0xe6, 0xb8, 0x8b, 0x3c, 0xf5, 0x6e, 0x3b, 0xb3,
+  0xa7, 0x85, 0x59, 0x97, 0x3c, 0x59, 0x8a, 0xe8, 0xae, 0x10, 0xb9, 0xa0, 0xa0, 0x03, 0xd9, 0xd2,
+  0xf6, 0x82, 0xa9, 0x80, 0xb0, 0x56, 0x50, 0x4c, 0xd7, 0xe9, 0x74, 0xaa, 0xc3, 0xa4, 0x98, 0x62,
+  0x29, 0x89, 0xa2, 0xdb, 0x65, 0x37, 0x11, 0x70, 0x83, 0x79, 0x53, 0xb6, 0x88, 0x61, 0x1d, 0xf0,
+  0x62, 0xc6, 0x5d, 0x8f, 0x0a, 0x80, 0x4e, 0xb0, 0x92, 0x5b, 0x48, 0x6c, 0xea, 0x71, 0xdf, 0x95,
+  0xbb, 0x57, 0xc0, 0x1b, 0xec, 0x77, 0x11, 0x9f, 0xa9, 0x5e, 0x23, 0x36, 0x75, 0xfc, 0x58, 0xed,
+  0x53, 0x60, 0x33, 0x82, 0xa3, 0xd3, 0x16, 0x00, 0x38, 0x62, 0xc1, 0xc2, 0xf7, 0x65, 0x5b, 0x3a,
+  0x1e, 0xd5, 0xc2, 0x68, 0x37, 0xba, 0x1d, 0x71, 0x58, 0xdc, 0xe2, 0x19, 0x5b, 0xce, 0x78, 0x20,
+  0x87, 0x9f, 0x8a, 0x09, 0xfc, 0x8d, 0x19, 0x6a, 0x70, 0x3e, 0x74, 0x4c, 0xb0, 0x2e, 0xb4, 0xcd,
+  0xc1, 0x8d, 0x75, 0x1c, 0xd7, 0x3d, 0xbb, 0x87, 0x0f, 0xaf, 0x21, 0x16, 0xe7, 0x01, 0x68, 0x6f,
+  0x93, 0xc0, 0xbc, 0xa0, 0xd9, 0x62, 0x16, 0xb7, 0xd9, 0xe8, 0x24, 0x2b, 0x15, 0xc3, 0xb4, 0x2c,
+  0xde, 0x49, 0x20, 0xf0, 0xe6, 0x09, 0xfc, 0xb9, 0xbd, 0xc4, 0xf2, 0xfa, 0x68, 0x34, 0x62, 0xcd,
+  0x8b, 0xcb, 0xab, 0xf7, 0x37, 0x4d, 0xf6, 0xdb, 0x6f, 0xac, 0xba, 0xfd, 0xfa, 0xec, 0xf5, 0xd9,
+  0xe9, 0x4d, 0xd3, 0xce, 0x50, 0xb1, 0xd2, 0xc4, 0x93, 0x68, 0x91, 0xed, 0xcf, 0x30, 0x10, 0x1a,
+  0x77, 0x22, 0x35, 0x71, 0x4b, 0x63, 0x42, 0x56, 0xdc, 0x96, 0x55, 0xdb, 0x47, 0xdb, 0x64, 0xc7,
+  0x3b, 0x59, 0x14, 0x34, 0xf8, 0xb1, 0xcb, 0xd4, 0x7a, 0xc7, 0x9c, 0x29, 0x38, 0x15, 0xc9, 0x1a,
+  0xd0, 0xa6, 0x30, 0x13, 0xce, 0x56, 0x0c, 0x81, 0xc1, 0xbf, 0x32, 0x47, 0x36, 0xce, 0x99, 0x15,
+  0xd4, 0x01, 0x2d, 0x52, 0x75, 0xb7, 0x0c, 0xb2, 0xaa, 0xf8, 0xab, 0x29, 0x16, 0x71, 0xae, 0xc5,
+  0x76, 0x7b, 0xbd, 0xde, 0x06, 0x7e, 0xbe, 0xf4, 0x63, 0xc1, 0x42, 0xd2, 0xb1, 0x5c, 0xad, 0x70,
+  0x65, 0xd8, 0xa8, 0x44, 0xa4, 0x70, 0x4f, 0x67, 0xd8, 0x17, 0xd4, 0x90, 0xbf, 0x3f, 0xb7, 0xce,
+  0x79, 0x32, 0x99, 0x51, 0x19, 0x5a, 0xae, 0x6e, 0x58, 0x9c, 0x66, 0xd3, 0x05, 0x7a, 0x2c, 0xb9,
+  0xe3, 0x63, 0x85, 0xc2, 0x87, 0xf8, 0xa4, 0x45, 0x7d, 0xc0, 0x2a, 0x9b, 0x4a, 0x47, 0x9b, 0x8c,
+  0x23, 0xf7, 0x62, 0x9b, 0x30, 0x4d, 0x17, 0xc1, 0x84, 0x96, 0x7f, 0x89, 0x45, 0x96, 0xcc, 0xac,
+  0x9c, 0x33, 0x30, 0xd2, 0xf5, 0x9d, 0x17, 0xa6, 0x83, 0x94, 0x9d, 0x8d, 0xc6, 0x6b, 0x63, 0x5e,
+  0x3a, 0x73, 0x23, 0x0e, 0xa1, 0x7e, 0x60, 0xce, 0x47, 0xcd, 0x04, 0x28, 0xc0, 0x89, 0x58, 0xcd,
+  0xae, 0x13, 0x7a, 0x5d, 0x49, 0x7a, 0xd3, 0xce, 0x20, 0x3b, 0x30, 0xab, 0xc0, 0x02, 0xb2, 0x43,
+  0xc8, 0x4e, 0x39, 0x32, 0x32, 0xfd, 0xdc, 0xf9, 0x25, 0x16, 0x81, 0x65, 0x17, 0xbb, 0x02, 0x95,
+  0x4e, 0x91, 0xdf, 0x30, 0x07, 0xb5, 0xda, 0xcf, 0xd2, 0xaa, 0xbb, 0x1c, 0x48, 0x97, 0x09, 0x75,
+  0xf8, 0xf9, 0xcf, 0x8a, 0x01, 0x4d, 0x55, 0x18, 0x07, 0xa5, 0x42, 0x8c, 0x9d, 0x14, 0xb0, 0x83,
+  0x0f, 0x65, 0x51, 0x5d, 0x93, 0x7d, 0x25, 0x38, 0xa6, 0xe5, 0x25, 0x70, 0x7c, 0x98, 0x96, 0xc5,
+  0x37, 0x21, 0x08, 0xb8, 0x28, 0xc1, 0x07, 0xaa, 0xb0, 0xbd, 0x09, 0x96, 0xaa, 0xcb, 0x25, 0x68,
+  0x7a, 0x2a, 0x6b, 0xd3, 0x9b, 0x10, 0x60, 0x7d, 0xb8, 0x04, 0x8f, 0x0f, 0x37, 0x02, 0xf2, 0x71,
+  0x19, 0x8e, 0x8f, 0x65, 0x4d, 0xd8, 0x00, 0xae, 0x94, 0x90, 0xdc, 0x22, 0x2a, 0xcb, 0x27, 0xb3,
+  0x7e, 0xb0, 0xe5, 0x33, 0x9f, 0xe3, 0xc7, 0x1f, 0x57, 0x17, 0xae, 0xd5, 0x2c, 0x56, 0x50, 0x9b,
+  0x76, 0xc7, 0x0b, 0xc0, 0x2b, 0xfc, 0x7c, 0xf3, 0xe6, 0x35, 0xd8, 0x96, 0x86, 0x82, 0x49, 0xaa,
+  0x72, 0x80, 0xce, 0x44, 0x08, 0x1f, 0x4d, 0xf0, 0x07, 0xd6, 0x94, 0xd5, 0x69, 0xb5, 0x7c, 0x43,
+  0xae, 0x76, 0x72, 0xfa, 0xf6, 0xed, 0x6b, 0xda, 0x49, 0xa2, 0x9a, 0x74, 0x93, 0x1d, 0x16, 0xfb,
+  0x4c, 0xa7, 0x2a, 0x52, 0x96, 0x1d, 0x8e, 0xb6, 0x21, 0x56, 0xaf, 0xa5, 0x02, 0xa1, 0xb8, 0xb3,
+  0x7c, 0x2a, 0xb7, 0x2b, 0x81, 0x54, 0xa2, 0x4e, 0xf5, 0xc0, 0x0c, 0xb9, 0x93, 0x88, 0x73, 0x90,
+  0xb5, 0x6b, 0xf5, 0x6d, 0xf6, 0x1d, 0x6b, 0x42, 0x9e, 0xbc, 0xdd, 0x20, 0x69, 0xe2, 0x5e, 0x3d,
+  0x80, 0x36, 0xfd, 0xb4, 0xe3, 0x73, 0x07, 0xca, 0xeb, 0x9b, 0xd5, 0x43, 0x61, 0x3b, 0x55, 0x4d,
+  0x37, 0x4b, 0x3d, 0xad, 0x59, 0x60, 0xe1, 0x85, 0xa9, 0xec, 0x08, 0x5c, 0x98, 0x08, 0xfc, 0x15,
+  0xba, 0x96, 0x40, 0x24, 0x78, 0x26, 0x22, 0x02, 0xe4, 0xf0, 0x60, 0xcc, 0x51, 0x68, 0xe8, 0x7f,
+  0xb8, 0x6b, 0x6b, 0xf8, 0x00, 0x0e, 0xe2, 0xd2, 0x58, 0xab, 0xd2, 0x9c, 0xf9, 0x48, 0xcb, 0x26,
+  0x46, 0x51, 0xb9, 0xa7, 0x69, 0xe8, 0xa6, 0x44, 0x25, 0x2b, 0x21, 0x69, 0x41, 0x65, 0x3d, 0xb2,
+  0x42, 0xd5, 0xc4, 0x44, 0x87, 0xde, 0x31, 0x5f, 0xbf, 0xe8, 0x74, 0x85, 0x02, 0x66, 0xdf, 0x8c,
+  0x46, 0x05, 0x92, 0x6d, 0xc3, 0x79, 0x49, 0x17, 0x2c, 0xeb, 0x73, 0x4c, 0x26, 0x65, 0x10, 0x8b,
+  0x82, 0x6b, 0x17, 0x4b, 0x72, 0xf9, 0x11, 0xf0, 0x17, 0x13, 0xed, 0x58, 0x75, 0x89, 0xf8, 0x2d,
+  0xac, 0x8b, 0xd1, 0xca, 0x40, 0x81, 0xd1, 0x9d, 0x82, 0x55, 0x76, 0xd1, 0xdc, 0x5c, 0xb3, 0x32,
+  0x94, 0x40, 0x19, 0x8f, 0x2a, 0xfc, 0x75, 0xa6, 0x22, 0x3a, 0x73, 0xc0, 0x6d, 0xa7, 0xa3, 0x16,
+  0x3c, 0x2e, 0xfe, 0xa7, 0x8f, 0xf7, 0xdd, 0x88, 0x7d, 0x2a, 0x0c, 0xf8, 0x4f, 0xbf, 0x2a, 0x58,
+  0x30, 0x57, 0x97, 0x3f, 0x3c, 0x42, 0xf4, 0xeb, 0x05, 0x77, 0x18, 0xbe, 0xe7, 0x2d, 0x78, 0xa4,
+  0xe2, 0x31, 0xa3, 0xe7, 0x93, 0x49, 0xcf, 0xa3, 0x6d, 0x7e, 0x47, 0x1e, 0x9b, 0x8c, 0xd4, 0x1c,
+  0x01, 0x72, 0x59, 0x23, 0xc8, 0x2e, 0x51, 0x5b, 0x0b, 0x69, 0xc0, 0x15, 0x28, 0xd8, 0x59, 0x83,
+  0x41, 0x9e, 0x5b, 0x53, 0x96, 0xa0, 0xb7, 0xe9, 0x38, 0x1e, 0xb7, 0xd7, 0x91, 0xa2, 0x2e, 0x16,
+  0xa7, 0x50, 0x6c, 0x37, 0x09, 0x30, 0x5b, 0x35, 0x83, 0xaf, 0xa3, 0xa6, 0xaa, 0xe2, 0x79, 0x24,
+  0x75, 0x71, 0x26, 0x96, 0xdd, 0x99, 0x07, 0x76, 0x2a, 0x91, 0xe6, 0xc6, 0x9b, 0x27, 0x1b, 0xeb,
+  0x4d, 0x5d, 0xe5, 0x53, 0x94, 0x1f, 0x98, 0x36, 0xbe, 0xde, 0xb2, 0x65, 0x3d, 0x2d, 0x2d, 0xcc,
+  0xad, 0x37, 0xc7, 0x42, 0xed, 0xad, 0xca, 0xba, 0xf3, 0xf2, 0x17, 0x15, 0xd2, 0xd6, 0xe3, 0x2b,
+  0xd6, 0xca, 0xaa, 0x10, 0x42, 0xb4, 0x85, 0x85, 0x2f, 0xc4, 0xb6, 0x1e, 0x99, 0x51, 0xd8, 0xaa,
+  0xc1, 0x94, 0x97, 0x4e, 0x36, 0xe3, 0xca, 0xeb, 0x24, 0x1b, 0xe6, 0x09, 0xab, 0xca, 0xf6, 0xd3,
+  0xa4, 0x35, 0xaa, 0x8c, 0x0e, 0x2b, 0x33, 0x54, 0xdd, 0x59, 0x8f, 0x29, 0xaf, 0x48, 0xd5, 0x21,
+  0xd9, 0x76, 0x86, 0x85, 0x52, 0x50, 0xb3, 0x2e, 0x88, 0xd8, 0x60, 0x40, 0x45, 0xed, 0x29, 0x1a,
+  0x50, 0xb1, 0xbd, 0x64, 0xc1, 0xa4, 0xb6, 0x1d, 0xb3, 0xdb, 0x35, 0x9f, 0x64, 0xc6, 0xd4, 0xb3,
+  0x9f, 0x69, 0xda, 0x25, 0x45, 0x2c, 0x92, 0x56, 0xea, 0x50, 0x43, 0x5b, 0xa1, 0xdf, 0x1b, 0x2f,
+  0xf8, 0x7c, 0xe2, 0x0c, 0xa5, 0x2e, 0x12, 0x66, 0x34, 0xd6, 0x10, 0xa5, 0xf5, 0xd1, 0xb9, 0xd5,
+  0xff, 0x0c, 0x82, 0x74, 0xcd, 0xa9, 0x20, 0x49, 0x6f, 0xae, 0x27, 0x2a, 0xef, 0xf5, 0xf9, 0x62,
+  0x23, 0xbb, 0x5a, 0x23, 0x35, 0x6a, 0x37, 0x49, 0xd1, 0xe2, 0x30, 0xb3, 0xe3, 0xe7, 0x73, 0x48,
+  0xb3, 0xd0, 0x22, 0x4d, 0x5a, 0x53, 0x0d, 0x67, 0xb2, 0x1e, 0x18, 0x15, 0xf7, 0x29, 0xee, 0xed,
+  0x35, 0x3f, 0x83, 0x90, 0x75, 0xb2, 0x2a, 0xb6, 0x6f, 0x22, 0x69, 0xb3, 0xc8, 0x2a, 0x97, 0x9c,
+  0x74, 0xf7, 0x54, 0x95, 0x19, 0x29, 0x4d, 0x28, 0x79, 0x24, 0x15, 0x78, 0xff, 0x98, 0x04, 0xeb,
+  0x7c, 0x51, 0xb9, 0x30, 0x6b, 0xba, 0xa3, 0x1c, 0xcb, 0x86, 0xd8, 0x5b, 0x4b, 0x3d, 0xf2, 0xf2,
+  0xed, 0x25, 0xb3, 0xce, 0x45, 0x34, 0xe1, 0x58, 0xc8, 0xb5, 0x89, 0xf5, 0x7a, 0x69, 0x37, 0x6b,
+  0xbc, 0xb4, 0x9b, 0x35, 0x63, 0x52, 0x81, 0xb3, 0x93, 0x17, 0x49, 0x4f, 0xb1, 0xae, 0xb9, 0x7e,
+  0xf4, 0xdf, 0x0d, 0x27, 0xe3, 0x83, 0xe1, 0x84, 0x46, 0x53, 0xb5, 0xd4, 0xe6, 0xc6, 0x78, 0x5d,
+  0x85, 0x81, 0x69, 0xd0, 0x99, 0xae, 0xe2, 0x18, 0x8f, 0x0a, 0x10, 0x8f, 0x5a, 0xc7, 0x29, 0xb3,
+  0x37, 0x17, 0x72, 0x0c, 0x44, 0x15, 0x70, 0x1a, 0x88, 0x9a, 0xb9, 0x86, 0x11, 0x64, 0x7a, 0x7e,
+  0xc2, 0x23, 0x3d, 0xc6, 0x4c, 0x03, 0xc3, 0x88, 0x4f, 0x39, 0x24, 0x03, 0x13, 0x40, 0xbe, 0x39,
+  0x14, 0xd5, 0xc7, 0xc3, 0x40, 0xb4, 0x10, 0xf9, 0x55, 0xed, 0x74, 0x17, 0x4e, 0x86, 0xac, 0xeb,
+  0x8a, 0x31, 0x6a, 0xe3, 0xa4, 0x14, 0xb3, 0x1a, 0xc7, 0x44, 0x74, 0x78, 0xad, 0x6b, 0x62, 0x5a,
+  0xfb, 0x63, 0xf1, 0xfc, 0x4a, 0x2d, 0xe0, 0x6c, 0x31, 0xf7, 0x20, 0x46, 0x5a, 0x69, 0xde, 0xfd,
+  0xf1, 0xf7, 0x6b, 0x40, 0x2b, 0x0b, 0xdf, 0x07, 0x5a, 0xe1, 0x3b, 0x47, 0x0d, 0x7f, 0x7d, 0x4e,
+  0x7a, 0x21, 0x4f, 0xa4, 0x4a, 0xbd, 0x78, 0xf1, 0xe2, 0x45, 0xf3, 0xf1, 0x48, 0x9f, 0xa6, 0x73,
+  0x8b, 0xde, 0x9c, 0x1d, 0xb3, 0x1e, 0x76, 0x86, 0x6f, 0x6c, 0x11, 0xdc, 0x05, 0x62, 0x19, 0x20,
+  0xc0, 0x1b, 0x60, 0x4d, 0x87, 0x14, 0xd0, 0x2a, 0xf4, 0xef, 0xb2, 0xfd, 0x1e, 0x25, 0x99, 0xb8,
+  0x9f, 0xc3, 0x9c, 0x5b, 0xd1, 0xac, 0xe6, 0x55, 0xc5, 0x43, 0x23, 0xfc, 0x37, 0x83, 0xff, 0x5a,
+  0x73, 0xd5, 0xcf, 0x29, 0x14, 0x0a, 0x03, 0x9a, 0x56, 0x6c, 0x54, 0x77, 0x55, 0xa5, 0x67, 0x58,
+  0xa5, 0xdf, 0x66, 0x58, 0xbd, 0xaa, 0xbf, 0xae, 0x1e, 0xf1, 0xe9, 0x18, 0x32, 0x35, 0x11, 0xdc,
+  0x9e, 0xbc, 0xbc, 0x3a, 0xc4, 0x13, 0xbe, 0xf4, 0x19, 0x84, 0x41, 0x56, 0xa0, 0x90, 0x74, 0x9c,
+  0xf0, 0xfa, 0xfa, 0xe2, 0xd5, 0x23, 0xfb, 0xe7, 0x72, 0xc3, 0xc5, 0xd5, 0xe3, 0xf1, 0x38, 0x3a,
+  0xf9, 0xc4, 0xbe, 0x33, 0xd0, 0x5a, 0x46, 0x37, 0x25, 0x01, 0x70, 0x45, 0x01, 0x9d, 0xd1, 0x01,
+  0x79, 0x15, 0x98, 0x9d, 0x91, 0x81, 0xa7, 0x07, 0xeb, 0x09, 0x51, 0x88, 0x60, 0xd0, 0x4f, 0x20,
+  0xe3, 0x2d, 0x71, 0x5c, 0x62, 0xe6, 0x9e, 0x0e, 0xfd, 0x49, 0x93, 0xda, 0xa3, 0x56, 0xb9, 0x9b,
+  0x38, 0x58, 0x02, 0xe4, 0x51, 0x84, 0xc6, 0x8b, 0xee, 0x58, 0x80, 0x17, 0x83, 0xaf, 0x22, 0xb2,
+  0x9a, 0xb2, 0xb4, 0x94, 0xd6, 0x1f, 0xf1, 0xa4, 0x35, 0x77, 0x0f, 0x9b, 0x2d, 0x06, 0xcd, 0xb6,
+  0x71, 0x5b, 0xab, 0xaa, 0x9c, 0x99, 0x55, 0xa6, 0xb8, 0x14, 0xcf, 0x85, 0xdb, 0x52, 0xa5, 0x25,
+  0x5b, 0xbb, 0xb1, 0x84, 0xee, 0x1f, 0x3b, 0xac, 0x71, 0xfc, 0x19, 0x7c, 0x36, 0x03, 0x7c, 0xd2,
+  0x21, 0x5f, 0x20, 0xcb, 0xca, 0x69, 0xd9, 0x15, 0xac, 0x81, 0x0e, 0x34, 0x92, 0xe1, 0xa8, 0xb3,
+  0xe1, 0x4d, 0x03, 0xc8, 0x5c, 0x18, 0x72, 0xb0, 0xb7, 0x7f, 0x22, 0x98, 0xf3, 0x97, 0x17, 0xaf,
+  0x9b, 0xf5, 0x13, 0xab, 0x4a, 0xcc, 0x0a, 0x73, 0xa1, 0x22, 0xca, 0x88, 0x85, 0x78, 0x33, 0xf2,
+  0x22, 0x48, 0xac, 0x6d, 0x0b, 0x20, 0x72, 0xf9, 0xb5, 0x8f, 0x76, 0xca, 0x35, 0x90, 0x9f, 0xe8,
+  0x8e, 0xd4, 0xf6, 0xe5, 0x0f, 0xb9, 0xb3, 0x9d, 0xaf, 0x8d, 0x2a, 0x6f, 0x2c, 0xa5, 0x8c, 0x72,
+  0xab, 0x88, 0x16, 0x0f, 0xaa, 0xf9, 0x83, 0x53, 0x50, 0x5d, 0x90, 0xa4, 0x1d, 0x3d, 0xb5, 0x25,
+  0x12, 0xd4, 0x0a, 0xa7, 0x2e, 0x00, 0x00, 0x41, 0x96, 0x9c, 0x2c, 0x04, 0x1b, 0xed, 0xbe, 0x8d,
+  0x5c, 0xa4, 0xeb, 0x58, 0xc4, 0x48, 0xbc, 0x84, 0xd3, 0xdc, 0xa4, 0x21, 0xfa, 0xa6, 0x70, 0x81,
+  0x8d, 0x21, 0x36, 0xc5, 0xb8, 0x13, 0xc6, 0x97, 0xec, 0xfd, 0xbb, 0xd7, 0xd7, 0xdc, 0x89, 0x26,
+  0x33, 0x02, 0x80, 0xce, 0xf9, 0xd5, 0x05, 0xfc, 0x0e, 0xc6, 0x18, 0xf2, 0x40, 0x63, 0x29, 0x0a,
+  0x06, 0xeb, 0xa0, 0xcf, 0x63, 0x7d, 0x01, 0xa9, 0x99, 0xbd, 0xaf, 0x43, 0x5b, 0xaa, 0x42, 0xad,
+  0x47, 0x6c, 0x46, 0x9e, 0xeb, 0x10, 0x97, 0x12, 0xc3, 0x02, 0x62, 0x10, 0x30, 0xe8, 0xf4, 0x3d,
+  0x8f, 0x68, 0x07, 0x76, 0xee, 0xf9, 0xbe, 0xa7, 0x76, 0xc2, 0xaa, 0x47, 0x36, 0xd3, 0xa8, 0x75,
+  0x23, 0x97, 0x32, 0x79, 0x15, 0x25, 0xfe, 0x01, 0xcf, 0xe6, 0xf5, 0x54, 0x51, 0x22, 0xdd, 0x75,
+  0xc3, 0xb1, 0xe3, 0x8d, 0x73, 0xa5, 0x04, 0xbe, 0xf5, 0x94, 0x64, 0x3f, 0x1b, 0x73, 0xbf, 0x97,
+  0x0f, 0xaa, 0x0e, 0xde, 0x18, 0x83, 0x6a, 0x7c, 0xd0, 0x69, 0xda, 0xc8, 0x0f, 0x2d, 0x4b, 0x5a,
+  0x47, 0x59, 0xa1, 0x72, 0x50, 0x60, 0x45, 0x2d, 0xea, 0x3c, 0x70, 0xde, 0x84, 0x5c, 0xcf, 0xb3,
+  0xd7, 0xeb, 0x4e, 0x16, 0x95, 0xaf, 0x43, 0xa9, 0x57, 0x01, 0xb6, 0x44, 0xb7, 0x1d, 0xad, 0xa5,
+  0xa2, 0x40, 0x01, 0x7b, 0xc5, 0xe6, 0x92, 0x34, 0x78, 0x40, 0x9a, 0x87, 0x87, 0x60, 0xf9, 0x33,
+  0xe1, 0x62, 0x9c, 0xfd, 0xf6, 0xfa, 0xa6, 0xd9, 0xca, 0x9e, 0xe3, 0x1d, 0x1b, 0x70, 0x09, 0x87,
+  0xec, 0xd7, 0xa6, 0xf2, 0xd4, 0xed, 0x9b, 0x55, 0xc8, 0x9b, 0xd0, 0x13, 0xe8, 0xf5, 0xbd, 0x09,
+  0xa9, 0x62, 0xf7, 0xa1, 0xbd, 0x5c, 0x82, 0x87, 0x17, 0xd1, 0xbc, 0xbd, 0x88, 0x7c, 0x88, 0x47,
+  0xc1, 0x96, 0xdd, 0xe6, 0x63, 0x8e, 0x07, 0x2f, 0xe9, 0x1c, 0xaa, 0x99, 0xee, 0x14, 0xd6, 0xbd,
+  0xad, 0xb7, 0xb6, 0xea, 0x36, 0xb6, 0x20, 0x50, 0x8b, 0x12, 0xb9, 0xd6, 0xcf, 0x81, 0x05, 0x18,
+  0x83, 0xfd, 0xf6, 0x1b, 0x4c, 0x25, 0xf3, 0x68, 0xca, 0xc5, 0xb9, 0xdf, 0xe8, 0x39, 0x8a, 0xb9,
+  0xcf, 0x77, 0xa4, 0x76, 0xb2, 0xe5, 0xee, 0xb5, 0x5a, 0x8b, 0xbc, 0xf9, 0x9c, 0xbb, 0x1e, 0xf4,
+  0xf2, 0x57, 0x25, 0xa2, 0x8d, 0xa5, 0x5a, 0x52, 0xd0, 0x7c, 0x6f, 0xac, 0xcd, 0x10, 0xdb, 0x7d,
+  0xb7, 0x69, 0x75, 0x36, 0x0e, 0xd3, 0xe4, 0x97, 0xe6, 0x34, 0x61, 0xa9, 0xdd, 0xb3, 0x5f, 0x4d,
+  0x09, 0x3d, 0x7e, 0x81, 0x9d, 0x41, 0x93, 0x01, 0x5b, 0x46, 0x21, 0xe7, 0x34, 0x37, 0x34, 0x65,
+  0x45, 0x3a, 0x9d, 0xba, 0xdd, 0x22, 0x0e, 0x29, 0x1c, 0xd6, 0xa9, 0x9c, 0xab, 0x4a, 0xe0, 0xba,
+  0xb2, 0xef, 0xd7, 0x99, 0xf5, 0xaf, 0x85, 0x84, 0x17, 0xe7, 0xe6, 0x8b, 0x5b, 0x2b, 0xcd, 0x30,
+  0x15, 0xa1, 0x14, 0x5a, 0xe9, 0x2a, 0xf5, 0x8c, 0x88, 0xcd, 0xc4, 0xb8, 0x7d, 0xc8, 0x66, 0xde,
+  0x00, 0xab, 0xe4, 0x94, 0xdc, 0x1d, 0xfc, 0xbb, 0x32, 0x2a, 0x61, 0xe3, 0xf5, 0x25, 0x81, 0xd2,
+  0xa5, 0x36, 0xb3, 0x22, 0x30, 0xae, 0x2e, 0x05, 0x44, 0x8b, 0x20, 0x50, 0x19, 0x78, 0xe1, 0xee,
+  0x1a, 0xc5, 0x2e, 0xe9, 0xb3, 0xab, 0x97, 0xef, 0xaf, 0xcf, 0x5e, 0x35, 0x8b, 0x08, 0xd7, 0xe6,
+  0xf9, 0x1a, 0xea, 0xf5, 0xc9, 0xfd, 0xd6, 0x21, 0xb8, 0xdc, 0x93, 0x7d, 0xb2, 0x3c, 0xd3, 0xb3,
+  0x66, 0x95, 0xa2, 0xc4, 0xd6, 0x2e, 0x20, 0xfa, 0x07, 0x32, 0x72, 0x3c, 0x0c, 0x87, 0x64, 0x3d,
+  0x6d, 0x8a, 0xea, 0x54, 0x5c, 0xfd, 0x24, 0xd3, 0xbd, 0xf8, 0x7f, 0x94, 0x69, 0xca, 0x2b, 0x6a,
+  0x4f, 0x9b, 0x68, 0xe9, 0x44, 0x9e, 0x71, 0xc8, 0x86, 0x4e, 0xc5, 0x45, 0x73, 0xab, 0x29, 0x8f,
+  0xe0, 0x19, 0xc7, 0xe6, 0xc0, 0x65, 0xba, 0x0a, 0xca, 0x3c, 0x42, 0xf7, 0x03, 0xbb, 0x99, 0x79,
+  0x31, 0x5b, 0x42, 0x68, 0x84, 0xe8, 0x13, 0x07, 0x43, 0xc7, 0x19, 0x67, 0xf2, 0xcd, 0x2c, 0x9d,
+  0xa6, 0xad, 0x57, 0x0b, 0x75, 0xa6, 0x12, 0x2d, 0xc8, 0xcf, 0xc2, 0xf2, 0xad, 0xeb, 0xf3, 0x93,
+  0x78, 0xba, 0xce, 0x05, 0x54, 0x2d, 0xb3, 0x85, 0x8d, 0xc7, 0xf2, 0x59, 0x1f, 0x06, 0x39, 0x48,
+  0x5a, 0xa8, 0xc2, 0x8b, 0x37, 0xb8, 0xce, 0x16, 0x4f, 0xf5, 0x14, 0x0c, 0x50, 0x97, 0x99, 0xa8,
+  0x92, 0xda, 0x19, 0xfe, 0x51, 0x92, 0x12, 0xda, 0xc5, 0xeb, 0xc7, 0xa2, 0xcc, 0x60, 0x3d, 0x7f,
+  0x8d, 0xb7, 0xf7, 0x29, 0x1e, 0x8a, 0x59, 0xb8, 0x88, 0x67, 0xf2, 0x36, 0x46, 0xce, 0x5c, 0x46,
+  0xef, 0x04, 0x90, 0x47, 0x32, 0xda, 0xd7, 0xe8, 0x95, 0xe8, 0x40, 0x55, 0x9c, 0x9d, 0x04, 0x84,
+  0xb4, 0x36, 0xd1, 0x53, 0x4c, 0xe3, 0x38, 0x60, 0xa6, 0x14, 0x18, 0x0a, 0xad, 0xae, 0x00, 0xbf,
+  0x15, 0xe6, 0xb2, 0xfa, 0xec, 0x83, 0x1a, 0xe1, 0x57, 0x39, 0x96, 0xf1, 0xbc, 0x23, 0x19, 0xe1,
+  0x96, 0xe7, 0x31, 0x9e, 0x7e, 0x16, 0x23, 0xdc, 0xe6, 0xf4, 0xc5, 0x73, 0x4e, 0x5e, 0x84, 0xe5,
+  0x63, 0x17, 0xf5, 0xc7, 0x7b, 0x42, 0xf3, 0x48, 0x0f, 0xda, 0x72, 0x49, 0xf4, 0x58, 0xc8, 0x47,
+  0xe1, 0xb3, 0x6f, 0xbf, 0xd5, 0xa8, 0xce, 0x9a, 0x8a, 0xfd, 0x8d, 0x43, 0x75, 0x15, 0xb1, 0x26,
+  0x01, 0xca, 0x7b, 0x35, 0x2e, 0xe3, 0x7e, 0xcc, 0x21, 0xef, 0x8f, 0x38, 0x6b, 0x33, 0x69, 0x2a,
+  0xa4, 0xa5, 0xe9, 0x01, 0x90, 0xc2, 0x81, 0xb1, 0x0a, 0xad, 0x0c, 0x2b, 0xb6, 0xd6, 0x4d, 0x5b,
+  0xb8, 0x12, 0xbe, 0x4f, 0xd7, 0xc5, 0x39, 0x28, 0xfb, 0x8a, 0x0d, 0x18, 0xba, 0x1c, 0x70, 0x1b,
+  0x0b, 0xf0, 0x53, 0x64, 0x1c, 0x44, 0x4c, 0xc0, 0xf1, 0xf5, 0x4c, 0x78, 0xa6, 0x22, 0x3f, 0xd9,
+  0x0a, 0xae, 0x91, 0x79, 0x09, 0x1e, 0x75, 0x13, 0x90, 0xa2, 0x64, 0xb6, 0x81, 0xc7, 0xea, 0xe4,
+  0xcd, 0x8b, 0x4a, 0xa3, 0x20, 0x47, 0xa6, 0x06, 0xb5, 0xe8, 0xed, 0x1d, 0x60, 0x88, 0xa6, 0xbb,
+  0xcc, 0x30, 0xd8, 0xf2, 0x60, 0xe1, 0x85, 0xea, 0xa5, 0x35, 0x64, 0x49, 0x92, 0x36, 0x18, 0xcc,
+  0x34, 0xeb, 0xa9, 0x73, 0x16, 0x5f, 0x17, 0xa3, 0x86, 0xa9, 0x62, 0x80, 0xba, 0xf5, 0x47, 0x6f,
+  0xca, 0x4a, 0x80, 0xcf, 0xa7, 0xd7, 0xff, 0x22, 0x1d, 0x31, 0x39, 0x53, 0x75, 0x2b, 0xae, 0x85,
+  0x75, 0x7b, 0x36, 0x5e, 0x4c, 0xee, 0x70, 0x86, 0x30, 0x9c, 0xba, 0x38, 0x17, 0xe2, 0x61, 0x33,
+  0x73, 0x82, 0xc6, 0x4d, 0xc2, 0x42, 0xc9, 0x44, 0x41, 0xad, 0x89, 0x96, 0x8c, 0x5b, 0x78, 0xcd,
+  0x42, 0xad, 0x89, 0xae, 0xbb, 0x6d, 0x03, 0x4d, 0x1d, 0xd3, 0x9c, 0xef, 0xa8, 0x62, 0xe1, 0x55,
+  0x1d, 0x7f, 0xc0, 0xdc, 0xcc, 0x49, 0x46, 0x93, 0xf8, 0xfe, 0x5b, 0x82, 0x19, 0x61, 0x72, 0x22,
+  0x87, 0x01, 0x5b, 0xfb, 0x96, 0x34, 0x27, 0xa6, 0x87, 0x92, 0xf4, 0x0e, 0x5d, 0xfb, 0xdb, 0x6a,
+  0x65, 0x16, 0x77, 0xe0, 0xa0, 0xb2, 0x6f, 0x68, 0x84, 0xc0, 0x0e, 0x88, 0xd8, 0x80, 0xb5, 0x90,
+  0xea, 0x83, 0xe7, 0xff, 0x85, 0x4f, 0x92, 0x0c, 0x54, 0xbd, 0xce, 0xa8, 0xb4, 0x92, 0x23, 0x5c,
+  0xc5, 0x79, 0xc5, 0xb3, 0x79, 0x98, 0xac, 0xb2, 0x23, 0x12, 0x81, 0x40, 0x6f, 0xee, 0x65, 0x6f,
+  0x1c, 0x88, 0x38, 0x9d, 0x13, 0xc7, 0x6a, 0x19, 0x9a, 0x8b, 0x14, 0x9b, 0xcd, 0xc6, 0x7c, 0x22,
+  0xe6, 0x9c, 0x5d, 0x3a, 0x97, 0x2d, 0x3a, 0x4d, 0xd1, 0x2b, 0x1f, 0x05, 0x10, 0x4b, 0x94, 0x0e,
+  0x0e, 0xda, 0x81, 0x44, 0x06, 0xc2, 0xec, 0x4e, 0x0c, 0xe9, 0x2c, 0xe4, 0x70, 0xff, 0x8a, 0x85,
+  0x95, 0x18, 0x32, 0x5b, 0x0e, 0x7e, 0xc8, 0x58, 0xde, 0x3a, 0x73, 0x27, 0xb4, 0x40, 0x9b, 0x69,
+  0xf6, 0xf8, 0x37, 0x05, 0x69, 0x01, 0x04, 0xb6, 0xdd, 0x63, 0xc3, 0xbd, 0x3c, 0x58, 0xdb, 0x04,
+  0x9e, 0xc0, 0xf8, 0xc0, 0x87, 0x4b, 0xba, 0xcc, 0x61, 0xdd, 0xdb, 0xb6, 0x59, 0xaa, 0x8f, 0x9c,
+  0x65, 0xaa, 0x3d, 0x92, 0xe5, 0x2d, 0xa2, 0x6a, 0x53, 0x9e, 0x51, 0xbf, 0x26, 0x92, 0x42, 0x22,
+  0x37, 0x94, 0xcc, 0x4b, 0x6b, 0xa4, 0x69, 0x0e, 0xa7, 0xe9, 0xdb, 0x4d, 0xb0, 0x82, 0xd2, 0xa2,
+  0x8b, 0x98, 0xf2, 0xf7, 0x5f, 0xe7, 0x5e, 0x90, 0x7e, 0x72, 0x1e, 0xf2, 0x6b, 0x98, 0x2d, 0xa6,
+  0xd6, 0xa3, 0xbf, 0x86, 0x93, 0x44, 0xdd, 0xb6, 0x34, 0x2d, 0xa2, 0x76, 0x4e, 0x45, 0xeb, 0x48,
+  0x1e, 0x80, 0xf9, 0x4a, 0xd1, 0x40, 0xb5, 0xc9, 0x69, 0x83, 0xda, 0x34, 0x07, 0x6e, 0xd1, 0x12,
+  0x96, 0x79, 0x47, 0xf5, 0x8a, 0xba, 0x59, 0xfe, 0x44, 0x5e, 0x57, 0xcd, 0x00, 0x92, 0x07, 0xdc,
+  0x29, 0xf3, 0xaf, 0x31, 0x27, 0xc0, 0x0d, 0x35, 0x7c, 0xb1, 0x4a, 0xb3, 0xd8, 0xfa, 0x0e, 0x95,
+  0xb1, 0xd7, 0x62, 0xf0, 0x6f, 0x09, 0xc8, 0x6c, 0xa3, 0x5d, 0xd0, 0xca, 0xd1, 0xa4, 0x17, 0x14,
+  0xd1, 0xab, 0xea, 0x9a, 0xfa, 0x8a, 0x80, 0x53, 0xe9, 0xf8, 0x3c, 0xb8, 0x4d, 0x66, 0xec, 0x98,
+  0x0d, 0x8c, 0x53, 0xe4, 0xa5, 0xb1, 0x71, 0xa7, 0xe8, 0xa8, 0xd4, 0x7e, 0x43, 0xd3, 0xbc, 0x14,
+  0xa9, 0x8c, 0x40, 0x83, 0x27, 0xf8, 0x76, 0x17, 0x97, 0xad, 0x28, 0x94, 0xeb, 0x03, 0x59, 0x03,
+  0x3d, 0x36, 0x5a, 0x7b, 0x62, 0x58, 0xb2, 0x28, 0xe9, 0xc1, 0x80, 0x48, 0xdb, 0x87, 0xde, 0x47,
+  0xf8, 0x07, 0xa2, 0xeb, 0xa7, 0x0f, 0x74, 0x8a, 0xdb, 0xac, 0x8f, 0xcd, 0x29, 0x2a, 0x8a, 0x6e,
+  0x04, 0x74, 0xbc, 0x80, 0x28, 0x34, 0xf0, 0x12, 0xf0, 0x7c, 0x33, 0x0f, 0xbe, 0xb6, 0xd3, 0xef,
+  0x69, 0x47, 0xc2, 0x91, 0xee, 0x2d, 0x46, 0xa6, 0x89, 0x12, 0x02, 0xda, 0xe4, 0x02, 0x9d, 0xb1,
+  0x7c, 0x01, 0xe2, 0xfe, 0xb0, 0xf7, 0x11, 0x16, 0x38, 0x42, 0x25, 0x1b, 0x9c, 0x07, 0x6b, 0xe6,
+  0xa5, 0x0d, 0x3b, 0xfa, 0x86, 0xf9, 0x37, 0x5e, 0x0c, 0x26, 0x62, 0x45, 0x1f, 0x06, 0x1f, 0x31,
+  0xc6, 0xad, 0xc4, 0x36, 0xa8, 0xc3, 0xb6, 0x8b, 0x0d, 0x8f, 0x3b, 0xc5, 0x5d, 0x30, 0xc4, 0x0b,
+  0xdd, 0xdb, 0x88, 0xec, 0x98, 0xf5, 0x11, 0x2d, 0x7c, 0xfd, 0x6e, 0xc4, 0x7a, 0x9d, 0xe1, 0x11,
+  0x3e, 0x6c, 0xab, 0x8f, 0x8f, 0x06, 0x0f, 0x51, 0x1f, 0xc9, 0xfd, 0x58, 0xb8, 0x32, 0x24, 0x3d,
+  0x9b, 0x75, 0xf3, 0x01, 0xfb, 0xc4, 0x52, 0xf9, 0xf8, 0x0f, 0xcc, 0x5a, 0x22, 0x2b, 0x0b, 0x6a,
+  0x8a, 0x15, 0x78, 0x32, 0x7f, 0xe2, 0xf3, 0x10, 0x7e, 0x81, 0x37, 0x40, 0x22, 0x10, 0x51, 0x4a,
+  0x10, 0x41, 0x63, 0x87, 0xdd, 0x5e, 0xb1, 0x3c, 0x87, 0xeb, 0xb3, 0x7e, 0xb5, 0x19, 0xd6, 0x0e,
+  0xbc, 0xd7, 0x0c, 0x7a, 0xa1, 0x5e, 0x42, 0x54, 0x25, 0x0c, 0x2b, 0x82, 0x15, 0xaf, 0x70, 0xa8,
+  0x5e, 0x92, 0x13, 0x90, 0x33, 0x65, 0x30, 0x71, 0xd6, 0x07, 0x36, 0xe8, 0x6a, 0xf0, 0x03, 0x7b,
+  0x20, 0x45, 0xfe, 0x40, 0x8d, 0xa8, 0x11, 0xe8, 0xac, 0x97, 0x47, 0xf5, 0xaa, 0x4c, 0x2f, 0x06,
+  0xfc, 0x7e, 0x0f, 0x94, 0x73, 0x78, 0x00, 0xda, 0x39, 0x1c, 0xb6, 0xa8, 0xb2, 0x05, 0x72, 0x1b,
+  0x7e, 0x84, 0xd9, 0x41, 0x30, 0x4f, 0xf1, 0x9a, 0x5d, 0xa1, 0xee, 0x64, 0x6c, 0x30, 0x1e, 0x8e,
+  0x42, 0x26, 0xa7, 0xf3, 0x94, 0x88, 0x6c, 0x33, 0xd5, 0x6c, 0xeb, 0xc6, 0xf8, 0x58, 0xc1, 0x9f,
+  0x77, 0x8b, 0x00, 0x02, 0x90, 0xa9, 0x74, 0xdd, 0x18, 0xb9, 0x40, 0xd8, 0x22, 0xab, 0xbe, 0xe0,
+  0xfd, 0x25, 0x97, 0x00, 0x9b, 0x5a, 0x18, 0x6e, 0x9d, 0x30, 0x66, 0x63, 0x58, 0x1e, 0xee, 0x64,
+  0x1c, 0xb5, 0x80, 0x08, 0x3f, 0x36, 0x97, 0x58, 0x44, 0x37, 0x4a, 0x01, 0x2b, 0x78, 0x88, 0xaf,
+  0xba, 0xf1, 0x91, 0x8b, 0x1f, 0x3e, 0x7c, 0xfc, 0xa8, 0x19, 0xe4, 0x1a, 0x73, 0x28, 0xa8, 0xb5,
+  0xc4, 0x8d, 0xba, 0x2d, 0x71, 0x7d, 0x90, 0x7f, 0x74, 0x83, 0xec, 0x60, 0xe0, 0x65, 0x99, 0xc7,
+  0xc1, 0x31, 0x16, 0x94, 0xfe, 0xa6, 0x16, 0x4a, 0x7e, 0x4e, 0xf1, 0x4a, 0x24, 0x1f, 0x3e, 0x1a,
+  0x4b, 0x47, 0xd1, 0x85, 0xa4, 0x7d, 0xd5, 0x59, 0x02, 0x98, 0x3e, 0x2d, 0xe2, 0x8b, 0x20, 0x45,
+  0x96, 0xf1, 0xbe, 0xcc, 0x7a, 0xfd, 0x9a, 0xb2, 0x7e, 0x47, 0x7f, 0x67, 0xad, 0xc6, 0xa4, 0xca,
+  0x82, 0xaa, 0xd3, 0xeb, 0x0c, 0x86, 0xb6, 0xe1, 0x8b, 0xc7, 0xfc, 0xd6, 0x0b, 0xae, 0x40, 0x1d,
+  0xf2, 0x1d, 0x24, 0x14, 0x89, 0x35, 0xc8, 0x0f, 0x32, 0x28, 0x1a, 0xb5, 0xeb, 0x13, 0x40, 0x6d,
+  0x59, 0xf9, 0x3d, 0xd0, 0x69, 0xc4, 0x88, 0x4b, 0xf2, 0x8d, 0xc8, 0xd5, 0x6d, 0x65, 0x91, 0x97,
+  0x40, 0xf5, 0xc6, 0xe6, 0x39, 0xe4, 0x7a, 0x55, 0xcd, 0x3a, 0xa7, 0x00, 0xbf, 0x5c, 0xfa, 0x6d,
+  0x08, 0x5b, 0x20, 0x4c, 0x8e, 0xf1, 0x93, 0x21, 0xec, 0xba, 0x81, 0x06, 0x26, 0x26, 0xec, 0x36,
+  0xf1, 0x45, 0xcc, 0xcd, 0x19, 0x3e, 0xda, 0xc5, 0xe5, 0xc8, 0xaa, 0xd0, 0xf4, 0x37, 0xdc, 0x09,
+  0x8c, 0x17, 0x23, 0xc8, 0x77, 0x2c, 0xc9, 0x55, 0xd8, 0x50, 0x62, 0x19, 0x8d, 0x60, 0xdd, 0x01,
+  0x35, 0xad, 0x25, 0x4f, 0x31, 0x14, 0x3d, 0x02, 0x8c, 0x84, 0x9b, 0xd0, 0x77, 0x3c, 0x95, 0x0f,
+  0xf5, 0x32, 0x69, 0xad, 0x90, 0x86, 0x92, 0x87, 0x44, 0x5d, 0x14, 0x8a, 0xa6, 0xae, 0x4f, 0x17,
+  0x4a, 0x6e, 0x17, 0xf5, 0x92, 0xc9, 0xfa, 0x14, 0xb9, 0x2a, 0xa7, 0x62, 0x95, 0xd5, 0x15, 0x47,
+  0xb2, 0x40, 0xd5, 0xb2, 0x03, 0x1b, 0xb6, 0xd1, 0xd2, 0xc7, 0x16, 0xf9, 0x12, 0xb3, 0x66, 0x05,
+  0xcf, 0x5f, 0xd1, 0xbb, 0x23, 0xc0, 0xed, 0xd2, 0xdb, 0x23, 0x98, 0xe3, 0x0b, 0x08, 0xa4, 0x28,
+  0xa6, 0xa4, 0xb7, 0x7b, 0xd5, 0x86, 0x18, 0xd3, 0x69, 0x5e, 0x48, 0xac, 0x70, 0x0d, 0xd2, 0x8e,
+  0x3f, 0xec, 0x7f, 0x64, 0x27, 0x0c, 0xdc, 0x64, 0xb5, 0x5f, 0x44, 0xa3, 0xde, 0x07, 0x63, 0x69,
+  0xb1, 0x7d, 0x5c, 0xd3, 0x8a, 0xd4, 0x95, 0x07, 0x1d, 0x8f, 0xc7, 0xa5, 0xb8, 0x86, 0x22, 0x8b,
+  0x99, 0x57, 0x91, 0x44, 0xb7, 0x18, 0xfa, 0xee, 0x3d, 0xbb, 0x12, 0xc2, 0x17, 0x75, 0x10, 0xe4,
+  0x6a, 0x0e, 0x2a, 0x43, 0xc7, 0x6b, 0xaa, 0x51, 0xe9, 0xf7, 0xfd, 0x76, 0x2a, 0xb2, 0x5c, 0xf9,
+  0xf6, 0x4b, 0x3d, 0x0b, 0x1c, 0xe4, 0x75, 0x1f, 0x23, 0x79, 0x52, 0x5d, 0xb5, 0xb4, 0x4e, 0x6b,
+  0x96, 0xe5, 0xa2, 0x6c, 0xaf, 0xf1, 0x92, 0x2f, 0x55, 0xd0, 0x04, 0x52, 0x8a, 0x22, 0x2c, 0xf0,
+  0x88, 0x60, 0x02, 0x36, 0xa2, 0x76, 0x21, 0x77, 0x52, 0x37, 0xbc, 0xf4, 0x02, 0x57, 0x2c, 0x3b,
+  0x54, 0xd0, 0xb9, 0x16, 0x8b, 0x68, 0xc2, 0x8b, 0x61, 0x68, 0x4c, 0x4f, 0xd5, 0xbe, 0xb6, 0xd6,
+  0x4f, 0xa5, 0x4e, 0xf2, 0x76, 0x58, 0xae, 0x2c, 0xb2, 0x7b, 0xc5, 0xad, 0x3b, 0x75, 0x59, 0x0b,
+  0xa2, 0x6d, 0xda, 0x0b, 0xca, 0x8a, 0x41, 0x7f, 0xbc, 0x7e, 0x7b, 0xd9, 0xa1, 0xc3, 0x07, 0x16,
+  0xef, 0x60, 0xdd, 0x4c, 0x53, 0xe6, 0x5a, 0x64, 0xe9, 0xe5, 0xb4, 0x16, 0x93, 0x35, 0xb4, 0x42,
+  0x65, 0xb3, 0x00, 0x2f, 0x02, 0x4c, 0xc9, 0xd1, 0x05, 0xd8, 0xea, 0x58, 0x58, 0xce, 0xed, 0xdd,
+  0x9e, 0x5e, 0x66, 0xcb, 0x00, 0x54, 0x0e, 0x51, 0x05, 0x31, 0xc8, 0xd9, 0x7c, 0x8e, 0xb5, 0x4b,
+  0xac, 0xab, 0xab, 0xfc, 0x9f, 0x4c, 0x01, 0x15, 0x9c, 0x47, 0xc4, 0x7e, 0x3a, 0xc8, 0x12, 0x67,
+  0xba, 0x71, 0xdc, 0x4d, 0xaf, 0xe4, 0x1e, 0x77, 0xe5, 0x0b, 0xf9, 0x8e, 0xbb, 0xf2, 0x35, 0xd5,
+  0xff, 0x07, 0xb7, 0x43, 0x92, 0x94, 0xbe, 0x5a, 0x00, 0x00,
+};
+
+#endif // DASHBOARD_HTML_H
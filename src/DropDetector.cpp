@@ -6,6 +6,10 @@ DropDetector* DropDetector::instance = nullptr;
 // ISR implementation
 void IRAM_ATTR DropDetector::handleInterrupt() {
   if (instance) {
+    // Keep the timestamp of the first edge until loop() consumes it
+    if (!instance->interruptTriggered) {
+      instance->interruptMicros = esp_timer_get_time();
+    }
     instance->interruptTriggered = true;
   }
 }
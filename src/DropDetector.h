@@ -2,6 +2,7 @@
 #define DROP_DETECTOR_H
 
 #include <M5Unified.h>
+#include <esp_timer.h>
 #include "config.h"
 
 class DropDetector {
@@ -12,6 +13,8 @@ private:
   bool initialized;
   
   volatile bool interruptTriggered;
+  volatile int64_t interruptMicros;  // Time of the first edge (esp_timer, set in ISR)
+  int64_t lastEdgeMicros;            // Edge time of the last valid detection
   unsigned long lastDetectionTime;
   bool interruptEnabled;
   
@@ -27,6 +30,8 @@ public:
       debounceMs(debounce),
       initialized(false),
       interruptTriggered(false),
+      interruptMicros(0),
+      lastEdgeMicros(0),
       lastDetectionTime(0),
       interruptEnabled(false) {
     instance = this;
@@ -71,6 +76,7 @@ public:
       if (currentTime - lastDetectionTime >= debounceMs) {
         // Valid detection!
         lastDetectionTime = currentTime;
+        lastEdgeMicros = interruptMicros;  // Safe: ISR only writes while flag is clear
         interruptTriggered = false;  // Clear the flag
         return true;
       } else {
@@ -81,6 +87,11 @@ public:
     return false;
   }
   
+  // Optical edge time (esp_timer microseconds) of the last valid detection
+  int64_t getLastEdgeMicros() const {
+    return lastEdgeMicros;
+  }
+  
   // Check if a drop is currently detected (without debouncing)
   bool isTriggered() const {
     return interruptTriggered;
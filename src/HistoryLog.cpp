@@ -0,0 +1,444 @@
+#include "HistoryLog.h"
+#include "WeatherCache.h"
+#include <ESPAsyncWebServer.h>
+
+// Global instance
+HistoryLog historyLog;
+
+// DS18B20 error values: -127 = disconnected, 85 = power-on reset
+static bool validTemperature(float temperature) {
+  return temperature != -127.0f && temperature != 85.0f;
+}
+
+// Mount LittleFS (formatted on first use) and find the existing segments
+bool HistoryLog::begin() {
+  if (!LittleFS.begin(true)) {
+    Serial.println("History: LittleFS mount failed");
+    return false;
+  }
+  if (!LittleFS.exists(DIRECTORY)) {
+    LittleFS.mkdir(DIRECTORY);
+  }
+
+  // Segment numbers from the file names
+  bool found = false;
+  uint32_t first = 0;
+  uint32_t last = 0;
+  File dir = LittleFS.open(DIRECTORY);
+  File entry = dir.openNextFile();
+  while (entry) {
+    const char* name = entry.name();
+    const char* base = strrchr(name, '/');
+    base = base ? base + 1 : name;
+    char* end;
+    unsigned long segment = strtoul(base, &end, 10);
+    if (end != base && strcmp(end, ".bin") == 0) {
+      if (!found || segment < first) first = segment;
+      if (!found || segment > last) last = segment;
+      found = true;
+    }
+    entry = dir.openNextFile();
+  }
+  dir.close();
+
+  firstSegment = first;
+  lastSegment = last;
+  lastSegmentRecords = 0;
+  if (found) {
+    char path[32];
+    segmentPath(path, last);
+    File file = LittleFS.open(path, "r");
+    size_t size = file ? file.size() : 0;
+    lastSegmentRecords = size / sizeof(Record);
+
+    // Keep new records after the newest stored one
+    Record record;
+    if (lastSegmentRecords > 0 &&
+        file.seek((lastSegmentRecords - 1) * sizeof(Record)) &&
+        file.read((uint8_t*)&record, sizeof(record)) == sizeof(record)) {
+      lastEpoch = record.epoch;
+    }
+    file.close();
+
+    if (size % sizeof(Record) != 0) {
+      // Torn write (power loss) - continue in a fresh segment
+      lastSegment = last + 1;
+      lastSegmentRecords = 0;
+    }
+  }
+
+  mounted = true;
+  Serial.printf("History: %lu segments, %lu records in the newest\n",
+                found ? (unsigned long)(last - first + 1) : 0UL, (unsigned long)lastSegmentRecords);
+  return true;
+}
+
+// Accumulate the published state (call from loop() once per iteration)
+// Temperature and Peltier duty are weighted by the time between calls.
+void HistoryLog::update(const SystemState::Snapshot& state) {
+  if (!mounted) return;
+
+  unsigned long now = millis();
+  if (!started) {
+    started = true;
+    intervalStart = now;
+    lastUpdate = now;
+    lastDropCount = state.dropCount;
+    return;
+  }
+
+  unsigned long dt = now - lastUpdate;
+  lastUpdate = now;
+  if (validTemperature(state.peltierTemp)) {
+    tempSum += state.peltierTemp * dt;
+    tempWeightMs += dt;
+  }
+  if (state.cooling) coolingMs += dt;
+  weightMs += dt;
+
+  if (now - intervalStart >= HISTORY_SAMPLE_INTERVAL) {
+    finishInterval(state, now);
+  }
+}
+
+// Close the current interval into a record
+void HistoryLog::finishInterval(const SystemState::Snapshot& state, unsigned long now) {
+  int drops = state.dropCount - lastDropCount;
+  lastDropCount = state.dropCount;
+
+  Record record;
+  record.epoch = WeatherCache::nowEpoch();
+  if (tempWeightMs) {
+    record.tempTenths = lroundf(tempSum / tempWeightMs * 10.0f);
+  } else if (validTemperature(state.peltierTemp)) {
+    record.tempTenths = lroundf(state.peltierTemp * 10.0f);
+  } else {
+    record.tempTenths = NO_TEMPERATURE;
+  }
+  record.setpointTenths = lroundf(state.setpoint * 10.0f);
+  record.coolingPct = weightMs ? (uint8_t)(coolingMs * 100 / weightMs) : (state.cooling ? 100 : 0);
+  record.drops = (uint8_t)constrain(drops, 0, 255);
+
+  intervalStart = now;
+  tempSum = 0;
+  tempWeightMs = 0;
+  coolingMs = 0;
+  weightMs = 0;
+
+  if (record.epoch == 0) {
+    skippedNoClock++;  // No wall clock yet (NTP not synced)
+    return;
+  }
+  if (record.epoch <= lastEpoch) {
+    return;  // Clock stepped back - keep the log in time order
+  }
+  lastEpoch = record.epoch;
+  append(record);
+}
+
+// Buffer a record; write the buffer out once it is full
+void HistoryLog::append(const Record& record) {
+  portENTER_CRITICAL(&lock);
+  pending[pendingCount++] = record;
+  bool full = (pendingCount >= HISTORY_FLUSH_RECORDS);
+  portEXIT_CRITICAL(&lock);
+
+  if (full) {
+    flush();
+  }
+}
+
+// Append the buffered records to the newest segment (one flash write)
+// Only loop() changes pending, so it is read here without the lock; the
+// lock guards the hand-over to readers copying the RAM tail.
+void HistoryLog::flush() {
+  if (pendingCount == 0) return;
+
+  if (lastSegmentRecords + pendingCount > HISTORY_SEGMENT_RECORDS) {
+    lastSegment = lastSegment + 1;
+    lastSegmentRecords = 0;
+
+    // Drop the oldest segments beyond the retention limit
+    char path[32];
+    while (lastSegment - firstSegment + 1 > HISTORY_MAX_SEGMENTS) {
+      segmentPath(path, firstSegment);
+      LittleFS.remove(path);
+      firstSegment = firstSegment + 1;
+    }
+  }
+
+  char path[32];
+  segmentPath(path, lastSegment);
+  size_t expected = pendingCount * sizeof(Record);
+  size_t written = 0;
+  File file = LittleFS.open(path, "a");
+  if (file) {
+    written = file.write((const uint8_t*)pending, expected);
+    file.close();
+  }
+
+  if (written == expected) {
+    lastSegmentRecords += pendingCount;
+    recordsWritten += pendingCount;
+  } else {
+    writeErrors++;
+    if (written > 0) {
+      lastSegmentRecords = HISTORY_SEGMENT_RECORDS;  // Partial record - next flush starts a new segment
+    }
+  }
+
+  portENTER_CRITICAL(&lock);
+  pendingCount = 0;
+  flushCount = flushCount + 1;
+  portEXIT_CRITICAL(&lock);
+}
+
+// ============================================
+// HistoryStream
+// ============================================
+
+int HistoryStream::active = 0;
+
+// First record time of a segment (0 if missing or empty)
+static uint32_t firstEpochOf(uint32_t segment) {
+  char path[32];
+  historyLog.segmentPath(path, segment);
+  File file = LittleFS.open(path, "r");
+  HistoryLog::Record record;
+  uint32_t epoch = 0;
+  if (file && file.read((uint8_t*)&record, sizeof(record)) == sizeof(record)) {
+    epoch = record.epoch;
+  }
+  file.close();
+  return epoch;
+}
+
+HistoryStream::HistoryStream(uint32_t from, uint32_t to, uint32_t bucketSec, bool csv)
+  : from(from),
+    to(to),
+    bucketSec(bucketSec),
+    csv(csv),
+    segment(historyLog.getFirstSegment()),
+    position(0),
+    tailDone(false),
+    finished(false),
+    lastEpoch(0),
+    batchLen(0),
+    batchPos(0),
+    hasBucket(false),
+    bucketStart(0),
+    tempSum(0),
+    tempRecords(0),
+    setpointSum(0),
+    coolingSum(0),
+    dropSum(0),
+    records(0),
+    tempMin(0),
+    tempMax(0),
+    carryLen(0),
+    carryPos(0),
+    headerSent(false) {
+  // Skip whole segments that end before 'from'
+  uint32_t last = historyLog.getLastSegment();
+  while (segment < last) {
+    uint32_t next = firstEpochOf(segment + 1);
+    if (next == 0 || next > from) break;
+    segment++;
+  }
+}
+
+HistoryStream::~HistoryStream() {
+  file.close();
+  __atomic_sub_fetch(&active, 1, __ATOMIC_SEQ_CST);
+}
+
+// Reserve a stream slot (released by the destructor)
+bool HistoryStream::acquire() {
+  if (__atomic_add_fetch(&active, 1, __ATOMIC_SEQ_CST) > HISTORY_MAX_STREAMS) {
+    __atomic_sub_fetch(&active, 1, __ATOMIC_SEQ_CST);
+    return false;
+  }
+  return true;
+}
+
+uint32_t HistoryStream::oldestEpoch() {
+  return firstEpochOf(historyLog.getFirstSegment());
+}
+
+// Read the next batch of records - segment files first, then the RAM tail
+bool HistoryStream::refill() {
+  batchLen = 0;
+  batchPos = 0;
+
+  while (!tailDone) {
+    uint32_t flushes = historyLog.getFlushCount();
+    uint32_t last = historyLog.getLastSegment();
+
+    while (segment <= last) {
+      if (!file) {
+        char path[32];
+        historyLog.segmentPath(path, segment);
+        file = LittleFS.open(path, "r");
+        if (file && position > 0) file.seek(position);
+      }
+      size_t bytes = file ? file.read((uint8_t*)batch, sizeof(batch)) : 0;
+      int count = bytes / sizeof(HistoryLog::Record);
+      if (count > 0) {
+        position += count * sizeof(HistoryLog::Record);
+        if (bytes % sizeof(HistoryLog::Record) != 0) file.seek(position);
+        batchLen = count;
+        return true;
+      }
+      file.close();  // Reopened later - sees records appended meanwhile
+      if (segment == last) break;
+      segment++;
+      position = 0;
+    }
+
+    int count = historyLog.copyPending(batch, HistoryLog::READ_BATCH, flushes);
+    if (count < 0) continue;  // Flushed while reading - read the new file data first
+    tailDone = true;
+    batchLen = count;
+    return count > 0;
+  }
+  return false;
+}
+
+void HistoryStream::startBucket(const HistoryLog::Record& record, uint32_t start) {
+  hasBucket = true;
+  bucketStart = start;
+  tempSum = 0;
+  tempRecords = 0;
+  setpointSum = 0;
+  coolingSum = 0;
+  dropSum = 0;
+  records = 0;
+  tempMin = INT16_MAX;
+  tempMax = INT16_MIN;
+  addRecord(record);
+}
+
+void HistoryStream::addRecord(const HistoryLog::Record& record) {
+  if (record.tempTenths != HistoryLog::NO_TEMPERATURE) {
+    tempSum += record.tempTenths;
+    tempRecords++;
+    if (record.tempTenths < tempMin) tempMin = record.tempTenths;
+    if (record.tempTenths > tempMax) tempMax = record.tempTenths;
+  }
+  setpointSum += record.setpointTenths;
+  coolingSum += record.coolingPct;
+  dropSum += record.drops;
+  records++;
+}
+
+// Format the finished bucket into carry
+void HistoryStream::formatBucket() {
+  int16_t temp = tempRecords ? lroundf((float)tempSum / tempRecords) : HistoryLog::NO_TEMPERATURE;
+  if (tempRecords == 0) {
+    tempMin = HistoryLog::NO_TEMPERATURE;
+    tempMax = HistoryLog::NO_TEMPERATURE;
+  }
+  int16_t setpoint = lroundf((float)setpointSum / records);
+  uint8_t cooling = (coolingSum + records / 2) / records;
+
+  if (csv) {
+    int n;
+    if (tempRecords) {
+      n = snprintf(carry, sizeof(carry), "%lu,%.1f,%.1f,%.1f,%.1f,%u,%lu\n",
+                   (unsigned long)bucketStart, temp / 10.0f, tempMin / 10.0f, tempMax / 10.0f,
+                   setpoint / 10.0f, cooling, (unsigned long)dropSum);
+    } else {
+      n = snprintf(carry, sizeof(carry), "%lu,,,,%.1f,%u,%lu\n",
+                   (unsigned long)bucketStart, setpoint / 10.0f, cooling, (unsigned long)dropSum);
+    }
+    carryLen = (n > 0) ? min((size_t)n, sizeof(carry) - 1) : 0;
+  } else {
+    struct __attribute__((packed)) {
+      uint32_t epoch;
+      int16_t temp;
+      int16_t tempMin;
+      int16_t tempMax;
+      int16_t setpoint;
+      uint8_t coolingPct;
+      uint8_t records;
+      uint16_t drops;
+    } point = {bucketStart, temp, tempMin, tempMax, setpoint, cooling,
+               (uint8_t)min(records, (uint32_t)255), (uint16_t)min(dropSum, (uint32_t)65535)};
+    static_assert(sizeof(point) == POINT_SIZE, "History point layout");
+    memcpy(carry, &point, sizeof(point));
+    carryLen = sizeof(point);
+  }
+  carryPos = 0;
+}
+
+void HistoryStream::formatHeader() {
+  if (csv) {
+    carryLen = snprintf(carry, sizeof(carry), "time,temp,temp_min,temp_max,setpoint,cooling_pct,drops\n");
+  } else {
+    uint16_t pointSize = POINT_SIZE;
+    uint16_t reserved = 0;
+    memcpy(carry, "DMH1", 4);
+    memcpy(carry + 4, &bucketSec, 4);
+    memcpy(carry + 8, &pointSize, 2);
+    memcpy(carry + 10, &reserved, 2);
+    carryLen = 12;
+  }
+  carryPos = 0;
+}
+
+// Fill the next response chunk
+size_t HistoryStream::fill(uint8_t* buffer, size_t maxLen) {
+  size_t written = 0;
+  uint32_t scanned = 0;
+
+  while (written < maxLen) {
+    // Output that did not fit last time goes first
+    if (carryPos < carryLen) {
+      size_t n = min(carryLen - carryPos, maxLen - written);
+      memcpy(buffer + written, carry + carryPos, n);
+      carryPos += n;
+      written += n;
+      continue;
+    }
+    if (!headerSent) {
+      headerSent = true;
+      formatHeader();
+      continue;
+    }
+    if (finished || scanned >= HISTORY_READ_BUDGET) {
+      break;
+    }
+
+    if (batchPos >= batchLen && !refill()) {
+      finished = true;  // No more records
+      if (hasBucket) formatBucket();
+      continue;
+    }
+
+    const HistoryLog::Record& record = batch[batchPos++];
+    scanned++;
+    if (record.epoch <= lastEpoch) continue;  // Already seen
+    lastEpoch = record.epoch;
+    if (record.epoch < from) continue;
+    if (record.epoch > to) {
+      finished = true;  // Records are in time order - nothing later matches
+      if (hasBucket) formatBucket();
+      continue;
+    }
+
+    uint32_t start = bucketSec ? from + (record.epoch - from) / bucketSec * bucketSec : record.epoch;
+    if (!hasBucket) {
+      startBucket(record, start);
+    } else if (start != bucketStart) {
+      formatBucket();
+      startBucket(record, start);
+    } else {
+      addRecord(record);
+    }
+  }
+
+  if (written == 0 && !(finished && carryPos >= carryLen)) {
+    return RESPONSE_TRY_AGAIN;  // Read budget used up - continue on the next poll
+  }
+  return written;
+}
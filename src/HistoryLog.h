@@ -0,0 +1,216 @@
+#ifndef HISTORY_LOG_H
+#define HISTORY_LOG_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <LittleFS.h>
+#include "config.h"
+#include "SystemState.h"
+
+// Long-term history of the installation (plate temperature, setpoint,
+// Peltier duty and drops), stored on LittleFS
+//
+// loop() averages the published state over HISTORY_SAMPLE_INTERVAL into one
+// 10-byte record, buffers HISTORY_FLUSH_RECORDS of them in RAM and appends
+// them to the current segment file in one write. Segments hold
+// HISTORY_SEGMENT_RECORDS records each; the oldest is deleted once there are
+// more than HISTORY_MAX_SEGMENTS. Records need wall-clock time, so nothing is
+// recorded until NTP has synced.
+//
+// /api/history reads the segments back through a HistoryStream.
+class HistoryLog {
+public:
+  // One stored record (little-endian, as written to flash)
+  struct __attribute__((packed)) Record {
+    uint32_t epoch;          // Unix time at the end of the interval
+    int16_t tempTenths;      // Mean plate temperature (NO_TEMPERATURE = no valid reading)
+    int16_t setpointTenths;  // Setpoint at the end of the interval
+    uint8_t coolingPct;      // Share of the interval the Peltier was on
+    uint8_t drops;           // Drops during the interval (saturates at 255)
+  };
+
+  static const int READ_BATCH = 32;  // Records read from flash at a time
+  static const int16_t NO_TEMPERATURE = INT16_MIN;  // Sensor gave no valid reading all interval
+
+private:
+  const char* DIRECTORY = "/history";
+
+  bool mounted;
+
+  // Segment files /history/<seq>.bin (firstSegment..lastSegment)
+  volatile uint32_t firstSegment;
+  volatile uint32_t lastSegment;
+  uint32_t lastSegmentRecords;
+
+  // Interval being averaged (loop() only)
+  bool started;
+  unsigned long intervalStart;
+  unsigned long lastUpdate;
+  float tempSum;             // Temperature x milliseconds (valid readings only)
+  unsigned long tempWeightMs;
+  unsigned long coolingMs;
+  unsigned long weightMs;
+  int lastDropCount;
+  uint32_t lastEpoch;
+
+  // Records not yet on flash (loop writes, web task copies)
+  Record pending[HISTORY_FLUSH_RECORDS];
+  int pendingCount;
+  volatile uint32_t flushCount;  // Bumped when pending moves to flash
+  portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+  // Statistics
+  volatile uint32_t recordsWritten;
+  volatile uint32_t writeErrors;
+  volatile uint32_t skippedNoClock;
+
+  void finishInterval(const SystemState::Snapshot& state, unsigned long now);
+  void append(const Record& record);
+
+public:
+  HistoryLog()
+    : mounted(false),
+      firstSegment(0),
+      lastSegment(0),
+      lastSegmentRecords(0),
+      started(false),
+      intervalStart(0),
+      lastUpdate(0),
+      tempSum(0),
+      tempWeightMs(0),
+      coolingMs(0),
+      weightMs(0),
+      lastDropCount(0),
+      lastEpoch(0),
+      pendingCount(0),
+      flushCount(0),
+      recordsWritten(0),
+      writeErrors(0),
+      skippedNoClock(0) {
+  }
+
+  // Mount LittleFS (formatted on first use) and find the existing segments
+  bool begin();
+
+  // Accumulate the published state (call from loop() once per iteration)
+  void update(const SystemState::Snapshot& state);
+
+  // Write the records buffered in RAM to flash now (before a restart)
+  void flush();
+
+  // Path of a segment file
+  void segmentPath(char (&out)[32], uint32_t segment) const {
+    snprintf(out, sizeof(out), "%s/%08lu.bin", DIRECTORY, (unsigned long)segment);
+  }
+
+  // Copy the records still in RAM (any task)
+  // Returns -1 if a flush happened since expectedFlushCount (the records
+  // are on flash now - read the files again).
+  int copyPending(Record* out, int maxRecords, uint32_t expectedFlushCount) {
+    portENTER_CRITICAL(&lock);
+    if (flushCount != expectedFlushCount) {
+      portEXIT_CRITICAL(&lock);
+      return -1;
+    }
+    int count = min(pendingCount, maxRecords);
+    memcpy(out, pending, count * sizeof(Record));
+    portEXIT_CRITICAL(&lock);
+    return count;
+  }
+
+  bool isMounted() const { return mounted; }
+  uint32_t getFirstSegment() const { return firstSegment; }
+  uint32_t getLastSegment() const { return lastSegment; }
+  uint32_t getFlushCount() const { return flushCount; }
+  uint32_t getLastEpoch() const { return lastEpoch; }
+  int getSegmentCount() const { return mounted ? (int)(lastSegment - firstSegment + 1) : 0; }
+
+  // Statistics
+  uint32_t getRecordsWritten() const { return recordsWritten; }
+  uint32_t getWriteErrors() const { return writeErrors; }
+  uint32_t getSkippedNoClock() const { return skippedNoClock; }
+};
+
+// One /api/history response in progress (async TCP task)
+//
+// Reads the segments in READ_BATCH chunks, averages the records into
+// buckets of bucketSec seconds and formats one point per bucket, so memory
+// use is the same for an hour or for weeks of data.
+//
+// CSV: "time,temp,temp_min,temp_max,setpoint,cooling_pct,drops" lines.
+// Binary (little-endian): 12-byte header "DMH1", uint32 bucketSec,
+// uint16 point size (16), uint16 reserved; then per point uint32 time,
+// int16 temp, tempMin, tempMax, setpoint (tenths of °C), uint8 coolingPct,
+// uint8 records in bucket (saturated), uint16 drops.
+// Buckets without a valid temperature have empty temp fields (CSV) or
+// -32768 (binary).
+class HistoryStream {
+public:
+  static const size_t POINT_SIZE = 16;
+
+private:
+  uint32_t from;
+  uint32_t to;
+  uint32_t bucketSec;
+  bool csv;
+
+  // Reading position
+  File file;
+  uint32_t segment;
+  size_t position;           // Byte offset in the segment
+  bool tailDone;             // RAM records copied - nothing left to read
+  bool finished;
+  uint32_t lastEpoch;        // Skips records seen twice (flush during a read)
+  HistoryLog::Record batch[HistoryLog::READ_BATCH];
+  int batchLen;
+  int batchPos;
+
+  // Bucket being averaged
+  bool hasBucket;
+  uint32_t bucketStart;
+  int32_t tempSum;
+  uint32_t tempRecords;      // Records with a valid temperature
+  int32_t setpointSum;
+  uint32_t coolingSum;
+  uint32_t dropSum;
+  uint32_t records;
+  int16_t tempMin;
+  int16_t tempMax;
+
+  // Formatted output that did not fit into the last chunk
+  char carry[80];
+  size_t carryLen;
+  size_t carryPos;
+  bool headerSent;
+
+  static int active;          // Streams in progress (see acquire)
+
+  bool refill();
+  void startBucket(const HistoryLog::Record& record, uint32_t start);
+  void addRecord(const HistoryLog::Record& record);
+  void formatBucket();
+  void formatHeader();
+
+public:
+  // from/to are Unix times (inclusive); bucketSec 0 = one point per record
+  HistoryStream(uint32_t from, uint32_t to, uint32_t bucketSec, bool csv);
+  ~HistoryStream();
+
+  // Reserve a stream slot (false if HISTORY_MAX_STREAMS are running)
+  static bool acquire();
+  static int getActive() { return active; }
+
+  // Epoch of the oldest stored record (0 if none)
+  static uint32_t oldestEpoch();
+
+  // Fill the next response chunk - 0 when done, RESPONSE_TRY_AGAIN when the
+  // read budget was used up without output (lets other clients run)
+  size_t fill(uint8_t* buffer, size_t maxLen);
+
+  const char* contentType() const { return csv ? "text/csv" : "application/octet-stream"; }
+};
+
+// Global instance
+extern HistoryLog historyLog;
+
+#endif // HISTORY_LOG_H
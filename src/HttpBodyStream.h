@@ -0,0 +1,151 @@
+#ifndef HTTP_BODY_STREAM_H
+#define HTTP_BODY_STREAM_H
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+
+// Response body of a keep-alive HTTP/1.1 request, read from the connection
+// HTTPClient::getStream() hands out the raw socket: on a kept-alive
+// connection the body is not ended by a close, so the reader has to stop
+// where the response ends. This wrapper decodes chunked bodies
+// (Transfer-Encoding: chunked) and bounds plain ones by Content-Length, and
+// returns -1 after the last body byte. drain() reads whatever the parser
+// left over so the next request starts on a clean connection.
+//
+// Reads block (up to the timeout) while the body is incomplete, so
+// Stream::timedRead() never sees a gap in the middle of a chunk header.
+class HttpBodyStream : public Stream {
+private:
+  WiFiClient& client;
+  bool chunked;
+  int32_t remaining;             // Bytes left in the body / current chunk (-1 = until close)
+  bool chunkPending;             // Chunked: the next read starts with a size line
+  bool complete;                 // Whole body read
+  bool failed;                   // Timeout, close or bad chunk header
+  int peeked;
+  uint32_t received;             // Body bytes (without chunk framing)
+  uint32_t readTimeoutMs;
+
+  // Next byte of the connection, waiting for it if necessary
+  int rawRead() {
+    unsigned long start = millis();
+    while (true) {
+      if (client.available() > 0) return client.read();
+      if (!client.connected()) return -1;
+      if (millis() - start >= readTimeoutMs) return -1;
+      delay(1);
+    }
+  }
+
+  // Read one CRLF-terminated line (CR dropped), at most size - 1 characters
+  bool rawLine(char* line, size_t size) {
+    size_t n = 0;
+    while (true) {
+      int c = rawRead();
+      if (c < 0) return false;
+      if (c == '\n') break;
+      if (c != '\r' && n + 1 < size) line[n++] = (char)c;
+    }
+    line[n] = '\0';
+    return true;
+  }
+
+  // Start the next chunk: CRLF of the previous one, then the size line
+  // A zero-size chunk ends the body (trailer lines are skipped).
+  bool nextChunk() {
+    char line[20];
+    if (received > 0 && (!rawLine(line, sizeof(line)) || line[0] != '\0')) return false;
+    if (!rawLine(line, sizeof(line))) return false;
+
+    char* end = nullptr;
+    unsigned long size = strtoul(line, &end, 16);  // Chunk extensions (";...") are ignored
+    if (end == line) return false;
+    chunkPending = false;
+    if (size > 0) {
+      remaining = (int32_t)size;
+      return true;
+    }
+
+    do {
+      if (!rawLine(line, sizeof(line))) return false;
+    } while (line[0] != '\0');
+    complete = true;
+    return true;
+  }
+
+  int readByte() {
+    if (complete || failed) return -1;
+    if (chunked && chunkPending && !nextChunk()) {
+      failed = true;
+      return -1;
+    }
+    if (complete) return -1;
+
+    int c = rawRead();
+    if (c < 0) {
+      if (remaining < 0) complete = true;  // Body ended by close
+      else failed = true;
+      return -1;
+    }
+    received++;
+    if (remaining > 0 && --remaining == 0) {
+      if (chunked) chunkPending = true;
+      else complete = true;
+    }
+    return c;
+  }
+
+public:
+  // contentLength: Content-Length of the response (-1 if there is none)
+  HttpBodyStream(WiFiClient& client, bool chunked, int contentLength, uint32_t timeoutMs)
+    : client(client),
+      chunked(chunked),
+      remaining(chunked ? 0 : contentLength),
+      chunkPending(chunked),
+      complete(!chunked && contentLength == 0),
+      failed(false),
+      peeked(-1),
+      received(0),
+      readTimeoutMs(timeoutMs) {
+  }
+
+  int available() override {
+    if (peeked >= 0) return 1;
+    if (complete || failed) return 0;
+    int n = client.available();
+    return (remaining > 0 && n > remaining) ? remaining : n;
+  }
+
+  int read() override {
+    if (peeked >= 0) {
+      int c = peeked;
+      peeked = -1;
+      return c;
+    }
+    return readByte();
+  }
+
+  int peek() override {
+    if (peeked < 0) peeked = readByte();
+    return peeked;
+  }
+
+  size_t write(uint8_t) override {
+    return 0;  // Read-only
+  }
+
+  // Read the rest of the body
+  // Returns true if the response ended cleanly - only then can the
+  // connection carry another request.
+  bool drain() {
+    peeked = -1;
+    while (readByte() >= 0) {
+    }
+    return complete && !failed;
+  }
+
+  bool isComplete() const { return complete && !failed; }
+  uint32_t getReceived() const { return received; }
+};
+
+#endif // HTTP_BODY_STREAM_H
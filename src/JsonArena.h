@@ -0,0 +1,110 @@
+#ifndef JSON_ARENA_H
+#define JSON_ARENA_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <stddef.h>
+
+// Fixed-capacity allocator for ArduinoJson documents
+// Hands out memory from a caller-provided buffer (bump allocation) and is
+// reset before each use, so building a document never touches the heap.
+// If the buffer runs out it falls back to malloc() and counts it - a non-zero
+// heapFallbacks means the arena is too small for the document.
+//
+// The buffer must be aligned to alignof(max_align_t), like malloc() memory.
+// Not thread-safe: one arena per task (the web handlers all run on the
+// async TCP task).
+class JsonArena : public ArduinoJson::Allocator {
+private:
+  uint8_t* pool;
+  size_t capacity;
+  size_t used;
+  size_t peak;
+  uint32_t heapFallbacks;
+
+  // Each block is preceded by its size so reallocate() can copy it
+  // (padded to max_align_t so the block after it stays aligned)
+  struct alignas(max_align_t) Header {
+    size_t size;
+  };
+
+  // Blocks (and the headers in front of them) keep the alignment malloc()
+  // guarantees, so any type ArduinoJson stores in them is aligned
+  static constexpr size_t ALIGNMENT = alignof(max_align_t);
+
+  static size_t align(size_t n) {
+    return (n + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+  }
+
+  bool owns(const void* ptr) const {
+    return ptr >= pool && ptr < pool + capacity;
+  }
+
+  static Header* headerOf(void* ptr) {
+    return reinterpret_cast<Header*>(static_cast<uint8_t*>(ptr) - sizeof(Header));
+  }
+
+public:
+  JsonArena(void* buffer, size_t size)
+    : pool(static_cast<uint8_t*>(buffer)),
+      capacity(size),
+      used(0),
+      peak(0),
+      heapFallbacks(0) {
+  }
+
+  // Forget all blocks (call when no document uses the arena any more)
+  void reset() {
+    used = 0;
+  }
+
+  void* allocate(size_t size) override {
+    size_t needed = sizeof(Header) + align(size);
+    if (used + needed > capacity) {
+      heapFallbacks++;
+      return malloc(size);
+    }
+    Header* header = reinterpret_cast<Header*>(pool + used);
+    header->size = size;
+    used += needed;
+    if (used > peak) peak = used;
+    return header + 1;
+  }
+
+  void deallocate(void* ptr) override {
+    if (ptr && !owns(ptr)) free(ptr);
+    // Arena blocks are released all at once by reset()
+  }
+
+  void* reallocate(void* ptr, size_t size) override {
+    if (ptr == nullptr) return allocate(size);
+    if (!owns(ptr)) return realloc(ptr, size);
+
+    Header* header = headerOf(ptr);
+    uint8_t* end = static_cast<uint8_t*>(ptr) + align(header->size);
+    if (end == pool + used) {
+      // Last block - grow or shrink in place
+      size_t start = static_cast<uint8_t*>(ptr) - pool;
+      if (start + align(size) <= capacity) {
+        used = start + align(size);
+        if (used > peak) peak = used;
+        header->size = size;
+        return ptr;
+      }
+    } else if (size <= header->size) {
+      header->size = size;
+      return ptr;
+    }
+
+    void* moved = allocate(size);
+    if (moved) memcpy(moved, ptr, min(header->size, size));
+    return moved;
+  }
+
+  // Statistics
+  size_t getCapacity() const { return capacity; }
+  size_t getPeak() const { return peak; }
+  uint32_t getHeapFallbacks() const { return heapFallbacks; }
+};
+
+#endif // JSON_ARENA_H
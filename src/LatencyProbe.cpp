@@ -0,0 +1,4 @@
+#include "LatencyProbe.h"
+
+// Global instance
+LatencyProbe latencyProbe;
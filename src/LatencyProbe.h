@@ -0,0 +1,163 @@
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <esp_timer.h>
+
+// Drop-to-feedback latency measurement
+// All stages are measured from the optical edge (timestamped in the ISR):
+//   - detect: DropDetector::update() consumed the edge in loop()
+//   - led:    neoPixels.onDropDetected() returned (strip show() complete)
+//   - audio:  the audio task finished the play command UART write
+//   - skew:   |audio - led| for the same drop (feedback should land together)
+// Each stage keeps a log2 histogram in microseconds, served by /api/latency.
+class LatencyProbe {
+public:
+  static const int NUM_BUCKETS = 18;  // bucket i: [2^i, 2^(i+1)) us, last one open-ended (~131 ms+)
+
+  struct Histogram {
+    uint32_t count;
+    uint64_t sumUs;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint32_t buckets[NUM_BUCKETS];
+  };
+
+  enum Stage {
+    STAGE_DETECT,
+    STAGE_LED,
+    STAGE_AUDIO,
+    STAGE_SKEW,
+    NUM_STAGES
+  };
+
+private:
+  Histogram histograms[NUM_STAGES];
+  int64_t lastEdgeUs;     // Edge of the drop currently being tracked
+  int64_t lastLedUs;      // LED completion for lastEdgeUs (0 = not yet)
+  int64_t lastAudioUs;    // Audio completion for lastEdgeUs (0 = not yet)
+  portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;  // Loop and audio task both record
+
+  static int bucketFor(uint32_t us) {
+    int bucket = 0;
+    while (us > 1 && bucket < NUM_BUCKETS - 1) {
+      us >>= 1;
+      bucket++;
+    }
+    return bucket;
+  }
+
+  void add(Stage stage, int64_t deltaUs) {
+    if (deltaUs < 0) deltaUs = 0;
+    uint32_t us = (deltaUs > UINT32_MAX) ? UINT32_MAX : (uint32_t)deltaUs;
+    Histogram& h = histograms[stage];
+    if (h.count == 0 || us < h.minUs) h.minUs = us;
+    if (us > h.maxUs) h.maxUs = us;
+    h.count++;
+    h.sumUs += us;
+    h.buckets[bucketFor(us)]++;
+  }
+
+  static const char* stageName(int stage) {
+    switch (stage) {
+      case STAGE_DETECT: return "detect";
+      case STAGE_LED:    return "led";
+      case STAGE_AUDIO:  return "audio";
+      case STAGE_SKEW:   return "skew";
+      default:           return "?";
+    }
+  }
+
+public:
+  LatencyProbe()
+    : lastEdgeUs(0),
+      lastLedUs(0),
+      lastAudioUs(0) {
+    memset(histograms, 0, sizeof(histograms));
+  }
+
+  // Current timestamp in microseconds (same clock as the ISR)
+  static int64_t now() {
+    return esp_timer_get_time();
+  }
+
+  // Drop edge consumed by loop() - starts tracking this drop
+  void recordDetect(int64_t edgeUs) {
+    if (edgeUs <= 0) return;  // Simulated drop - no optical edge
+    int64_t t = now();
+    portENTER_CRITICAL(&lock);
+    lastEdgeUs = edgeUs;
+    lastLedUs = 0;
+    lastAudioUs = 0;
+    add(STAGE_DETECT, t - edgeUs);
+    portEXIT_CRITICAL(&lock);
+  }
+
+  // LED flash shown for the drop with this edge
+  void recordLed(int64_t edgeUs) {
+    if (edgeUs <= 0) return;
+    int64_t t = now();
+    portENTER_CRITICAL(&lock);
+    add(STAGE_LED, t - edgeUs);
+    if (edgeUs == lastEdgeUs) {
+      lastLedUs = t;
+      if (lastAudioUs != 0) add(STAGE_SKEW, llabs(lastAudioUs - lastLedUs));
+    }
+    portEXIT_CRITICAL(&lock);
+  }
+
+  // Audio play command written for the drop with this edge (audio task)
+  void recordAudio(int64_t edgeUs) {
+    if (edgeUs <= 0) return;
+    int64_t t = now();
+    portENTER_CRITICAL(&lock);
+    add(STAGE_AUDIO, t - edgeUs);
+    if (edgeUs == lastEdgeUs) {
+      lastAudioUs = t;
+      if (lastLedUs != 0) add(STAGE_SKEW, llabs(lastAudioUs - lastLedUs));
+    }
+    portEXIT_CRITICAL(&lock);
+  }
+
+  // Clear all histograms
+  void reset() {
+    portENTER_CRITICAL(&lock);
+    memset(histograms, 0, sizeof(histograms));
+    portEXIT_CRITICAL(&lock);
+  }
+
+  // Copy one histogram (consistent snapshot)
+  Histogram getHistogram(Stage stage) {
+    portENTER_CRITICAL(&lock);
+    Histogram copy = histograms[stage];
+    portEXIT_CRITICAL(&lock);
+    return copy;
+  }
+
+  // Fill a JSON object with all stages
+  void toJson(JsonObject obj) {
+    for (int stage = 0; stage < NUM_STAGES; stage++) {
+      Histogram h = getHistogram((Stage)stage);
+      JsonObject s = obj[stageName(stage)].to<JsonObject>();
+      s["count"] = h.count;
+      s["minUs"] = h.minUs;
+      s["maxUs"] = h.maxUs;
+      s["avgUs"] = h.count ? (uint32_t)(h.sumUs / h.count) : 0;
+
+      // Buckets as [upper bound us, count] (upper bound 0 = open-ended)
+      JsonArray buckets = s["buckets"].to<JsonArray>();
+      for (int i = 0; i < NUM_BUCKETS; i++) {
+        if (h.buckets[i] == 0) continue;
+        JsonArray b = buckets.add<JsonArray>();
+        b.add(i < NUM_BUCKETS - 1 ? (1UL << (i + 1)) : 0);
+        b.add(h.buckets[i]);
+      }
+    }
+  }
+};
+
+// Global instance
+extern LatencyProbe latencyProbe;
+
+#endif // LATENCY_PROBE_H
@@ -0,0 +1,95 @@
+#ifndef METRICS_WRITER_H
+#define METRICS_WRITER_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+
+// Prometheus text exposition format into a caller-provided buffer
+// No heap, no JsonDocument: every sample is formatted straight into the
+// buffer. Output that does not fit is dropped and flagged - check
+// overflowed() before sending.
+class MetricsWriter {
+private:
+  char* buffer;
+  size_t capacity;
+  size_t length;
+  bool overflow;
+
+  void appendf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    if (overflow) return;
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buffer + length, capacity - length, format, args);
+    va_end(args);
+    if (n < 0 || (size_t)n >= capacity - length) {
+      overflow = true;
+      buffer[length] = '\0';  // Drop the partial line
+      return;
+    }
+    length += n;
+  }
+
+  // Label value with \, " and newlines escaped
+  void appendLabelValue(const char* value) {
+    for (const char* p = value; *p && !overflow; p++) {
+      switch (*p) {
+        case '\\': appendf("\\\\"); break;
+        case '"':  appendf("\\\""); break;
+        case '\n': appendf("\\n"); break;
+        default:   appendf("%c", *p); break;
+      }
+    }
+  }
+
+public:
+  MetricsWriter(char* buffer, size_t capacity)
+    : buffer(buffer),
+      capacity(capacity),
+      length(0),
+      overflow(capacity == 0) {
+    if (capacity > 0) buffer[0] = '\0';
+  }
+
+  // # HELP and # TYPE lines (type: "counter" or "gauge")
+  void family(const char* name, const char* type, const char* help) {
+    appendf("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+  }
+
+  // Unlabelled sample
+  void sample(const char* name, double value) {
+    appendf("%s %.10g\n", name, value);
+  }
+
+  // Sample with one label
+  void sample(const char* name, const char* label, const char* labelValue, double value) {
+    appendf("%s{%s=\"", name, label);
+    appendLabelValue(labelValue);
+    appendf("\"} %.10g\n", value);
+  }
+
+  // Sample with two labels
+  void sample(const char* name, const char* label1, const char* value1,
+              const char* label2, const char* value2, double value) {
+    appendf("%s{%s=\"", name, label1);
+    appendLabelValue(value1);
+    appendf("\",%s=\"", label2);
+    appendLabelValue(value2);
+    appendf("\"} %.10g\n", value);
+  }
+
+  // Single-sample families
+  void counter(const char* name, const char* help, double value) {
+    family(name, "counter", help);
+    sample(name, value);
+  }
+
+  void gauge(const char* name, const char* help, double value) {
+    family(name, "gauge", help);
+    sample(name, value);
+  }
+
+  size_t getLength() const { return length; }
+  bool overflowed() const { return overflow; }
+};
+
+#endif // METRICS_WRITER_H
@@ -0,0 +1,249 @@
+#include "OtaUpdater.h"
+
+// Global instance
+OtaUpdater otaUpdater;
+
+// The Arduino core marks new firmware valid at startup unless this returns
+// true - checkHealth() decides instead
+extern "C" bool verifyRollbackLater() {
+  return true;
+}
+
+// 64 hex digits into 32 bytes (SHA-256 and HMAC-SHA256 values)
+static bool parseDigest(const char* hex, uint8_t (&out)[32]) {
+  if (hex == nullptr || strlen(hex) != 64) return false;
+  for (int i = 0; i < 32; i++) {
+    char pair[3] = {hex[2 * i], hex[2 * i + 1], '\0'};
+    if (!isxdigit((unsigned char)pair[0]) || !isxdigit((unsigned char)pair[1])) return false;
+    out[i] = (uint8_t)strtoul(pair, nullptr, 16);
+  }
+  return true;
+}
+
+// Does signatureHex hold HMAC-SHA256(OTA_SECRET, lowercase hex of sha)?
+static bool signatureValid(const uint8_t (&sha)[32], const char* signatureHex) {
+  uint8_t given[32];
+  if (strlen(OTA_SECRET) == 0 || !parseDigest(signatureHex, given)) return false;
+
+  char message[65];
+  for (int i = 0; i < 32; i++) {
+    snprintf(message + 2 * i, 3, "%02x", sha[i]);
+  }
+  uint8_t expected[32];
+  if (mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256),
+                      (const uint8_t*)OTA_SECRET, strlen(OTA_SECRET),
+                      (const uint8_t*)message, 64, expected) != 0) {
+    return false;
+  }
+
+  uint8_t diff = 0;  // Constant time - no early exit on the first wrong byte
+  for (int i = 0; i < 32; i++) {
+    diff |= expected[i] ^ given[i];
+  }
+  return diff == 0;
+}
+
+void OtaUpdater::beginBoot() {
+  Preferences preferences;
+  preferences.begin(NAMESPACE, false);
+
+  if (preferences.getBool("rolledBack", false)) {
+    bootState = BOOT_ROLLED_BACK;  // Reported until the next successful upload
+  }
+
+  if (!preferences.getBool("trial", false)) {
+    preferences.end();
+    esp_ota_mark_app_valid_cancel_rollback();
+    return;
+  }
+
+  // The bootloader may already have fallen back to the old partition
+  const esp_partition_t* running = esp_ota_get_running_partition();
+  String previous = preferences.getString("previous", "");
+  if (running != nullptr && previous == running->label) {
+    preferences.putBool("trial", false);
+    preferences.putBool("rolledBack", true);
+    preferences.end();
+    bootState = BOOT_ROLLED_BACK;
+    Serial.println("OTA: new firmware did not start, running the previous one");
+    return;
+  }
+
+  uint8_t boots = preferences.getUChar("boots", 0) + 1;
+  preferences.putUChar("boots", boots);
+  requireSensor = preferences.getBool("sensor", false);
+  preferences.end();
+
+  if (boots > OTA_MAX_TRIAL_BOOTS) {
+    rollback("kept rebooting");
+    return;
+  }
+
+  bootState = BOOT_TRIAL;
+  trialStart = millis();
+  Serial.printf("OTA: trial boot %u of new firmware\n", boots);
+}
+
+void OtaUpdater::checkHealth(bool sensorRead, bool webServerUp, uint32_t loopIterations) {
+  sensorHealthy = sensorRead;
+  if (bootState != BOOT_TRIAL) return;
+
+  if ((sensorRead || !requireSensor) && webServerUp && loopIterations >= OTA_HEALTH_LOOPS) {
+    Preferences preferences;
+    preferences.begin(NAMESPACE, false);
+    preferences.putBool("trial", false);
+    preferences.end();
+    esp_ota_mark_app_valid_cancel_rollback();
+    bootState = BOOT_VERIFIED;
+    Serial.printf("OTA: new firmware healthy after %lu ms\n", millis() - trialStart);
+    return;
+  }
+
+  if (millis() - trialStart > OTA_HEALTH_TIMEOUT) {
+    rollback(!webServerUp ? "web server not up" :
+             (requireSensor && !sensorRead) ? "no sensor reading" : "loop not running");
+  }
+}
+
+// Boot the partition the update replaced (does not return if it worked)
+void OtaUpdater::rollback(const char* reason) {
+  Preferences preferences;
+  preferences.begin(NAMESPACE, false);
+  String previous = preferences.getString("previous", "");
+  preferences.putBool("trial", false);
+  preferences.putBool("rolledBack", true);
+  preferences.end();
+
+  Serial.printf("OTA: rolling back to %s (%s)\n", previous.c_str(), reason);
+  const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_APP,
+                                                              ESP_PARTITION_SUBTYPE_ANY,
+                                                              previous.c_str());
+  if (partition == nullptr || esp_ota_set_boot_partition(partition) != ESP_OK) {
+    Serial.println("OTA: previous firmware not bootable - keeping this one");
+    bootState = BOOT_VERIFIED;
+    return;
+  }
+  ESP.restart();
+}
+
+bool OtaUpdater::fail(const char* message) {
+  if (handleOpen) {
+    esp_ota_abort(handle);
+    mbedtls_sha256_free(&sha);
+    handleOpen = false;
+  }
+  error = message;
+  uploadState = UPLOAD_FAILED;
+  stats.failures++;
+  Serial.printf("OTA: upload failed - %s\n", message);
+  return false;
+}
+
+bool OtaUpdater::begin(const void* requester, size_t size, const char* sha256Hex,
+                       const char* signatureHex) {
+  if (uploadState == UPLOAD_RECEIVING) return false;  // getError() reports it
+
+  owner = requester;
+  received = 0;
+  expectedSize = size;
+  startedAt = millis();
+  lastChunkAt = startedAt;
+  unauthorized = false;
+
+  if (bootState == BOOT_TRIAL) {
+    return fail("Current firmware is not verified yet");
+  }
+  if (!parseDigest(sha256Hex, expectedSha)) {
+    return fail("X-Firmware-SHA256 header with 64 hex digits required");
+  }
+  if (!signatureValid(expectedSha, signatureHex)) {
+    unauthorized = true;
+    return fail(strlen(OTA_SECRET) == 0 ? "Firmware upload disabled (no OTA_SECRET)"
+                                        : "Missing or wrong X-Firmware-Signature");
+  }
+  target = esp_ota_get_next_update_partition(nullptr);
+  if (target == nullptr) {
+    return fail("No OTA partition");
+  }
+  if (size == 0 || size > target->size) {
+    return fail("Image size does not fit the OTA partition");
+  }
+  // Sequential writes: sectors are erased as they are reached
+  if (esp_ota_begin(target, OTA_WITH_SEQUENTIAL_WRITES, &handle) != ESP_OK) {
+    return fail("Could not start the update");
+  }
+  handleOpen = true;
+  mbedtls_sha256_init(&sha);
+  mbedtls_sha256_starts(&sha, 0);  // 0 = SHA-256 (not SHA-224)
+
+  uploadState = UPLOAD_RECEIVING;
+  Serial.printf("OTA: receiving %u bytes into %s\n", (unsigned)size, target->label);
+  return true;
+}
+
+bool OtaUpdater::write(const void* requester, const uint8_t* data, size_t length) {
+  if (requester != owner || uploadState != UPLOAD_RECEIVING) return false;
+
+  if (received + length > expectedSize) {
+    return fail("More data than Content-Length");
+  }
+  if (esp_ota_write(handle, data, length) != ESP_OK) {
+    return fail("Flash write failed");
+  }
+  mbedtls_sha256_update(&sha, data, length);
+  received += length;
+  lastChunkAt = millis();
+  return true;
+}
+
+bool OtaUpdater::finish(const void* requester) {
+  if (requester != owner || uploadState != UPLOAD_RECEIVING) return false;
+
+  if (received != expectedSize) {
+    return fail("Incomplete upload");
+  }
+
+  uint8_t digest[32];
+  mbedtls_sha256_finish(&sha, digest);
+  mbedtls_sha256_free(&sha);
+  if (memcmp(digest, expectedSha, sizeof(digest)) != 0) {
+    esp_ota_abort(handle);
+    handleOpen = false;
+    return fail("SHA-256 mismatch");
+  }
+
+  handleOpen = false;
+  if (esp_ota_end(handle) != ESP_OK) {  // Checks the image header and checksum
+    return fail("Image is not valid firmware");
+  }
+  if (esp_ota_set_boot_partition(target) != ESP_OK) {
+    return fail("Could not select the new firmware");
+  }
+
+  // Next boots are trials until checkHealth() accepts the firmware
+  const esp_partition_t* running = esp_ota_get_running_partition();
+  Preferences preferences;
+  preferences.begin(NAMESPACE, false);
+  preferences.putString("previous", running ? running->label : "");
+  preferences.putUChar("boots", 0);
+  preferences.putBool("sensor", sensorHealthy);
+  preferences.putBool("rolledBack", false);
+  preferences.putBool("trial", true);
+  preferences.end();
+
+  stats.uploads++;
+  stats.lastBytes = received;
+  stats.lastMs = lastChunkAt - startedAt;
+  uploadState = UPLOAD_IDLE;
+  owner = nullptr;
+  Serial.printf("OTA: %u bytes verified in %lu ms\n", (unsigned)received, (unsigned long)stats.lastMs);
+  return true;
+}
+
+void OtaUpdater::abort(const void* requester) {
+  if (requester != owner) return;
+  if (uploadState == UPLOAD_RECEIVING) {
+    fail("Connection closed during upload");
+  }
+  owner = nullptr;
+}
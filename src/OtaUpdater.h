@@ -0,0 +1,174 @@
+#ifndef OTA_UPDATER_H
+#define OTA_UPDATER_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <esp_ota_ops.h>
+#include <mbedtls/sha256.h>
+#include <mbedtls/md.h>
+#include "config.h"
+
+// Firmware update over HTTP, rolled back if the new firmware is unhealthy
+//
+// Authentication: the client sends X-Firmware-Signature, the HMAC-SHA256
+// (key OTA_SECRET) of the image's SHA-256 as 64 lowercase hex digits.
+// begin() refuses the upload before anything is written unless it matches;
+// since finish() checks the image against that SHA-256, only images signed
+// with the key are installed. Without OTA_SECRET no upload is accepted.
+//
+// Upload (async TCP task): /api/ota hands every request-body chunk to
+// write(), which appends it to the inactive OTA partition and feeds it to a
+// SHA-256 - nothing is buffered. The partition is erased sector by sector as
+// it fills instead of all at once up front, so loop() never stalls for
+// seconds; drops are caught by the IRAM interrupt even while flash is busy.
+// finish() only switches the boot partition if the size and the SHA-256
+// given by the client match and the image passes the ESP-IDF checks.
+//
+// Rollback: new firmware first runs in trial boots (counted in NVS). loop()
+// reports its health through checkHealth(); once the temperature sensor has
+// given a reading (if it did before the update), the web server is up and
+// loop() has run OTA_HEALTH_LOOPS times, the firmware is kept. If that does
+// not happen within OTA_HEALTH_TIMEOUT, or the firmware reboots more than
+// OTA_MAX_TRIAL_BOOTS times, the previous partition is booted again. This
+// does not depend on the bootloader's own rollback option.
+class OtaUpdater {
+public:
+  enum UploadState {
+    UPLOAD_IDLE,
+    UPLOAD_RECEIVING,
+    UPLOAD_FAILED                // error holds the reason until the next upload
+  };
+
+  enum BootState {
+    BOOT_NORMAL,                 // No update pending
+    BOOT_TRIAL,                  // New firmware, health not yet confirmed
+    BOOT_VERIFIED,               // New firmware passed its health checks
+    BOOT_ROLLED_BACK             // The last update was rolled back
+  };
+
+  struct Stats {
+    uint32_t uploads;            // Verified and installed
+    uint32_t failures;
+    uint32_t lastBytes;
+    uint32_t lastMs;             // First to last chunk of the last install
+  };
+
+private:
+  const char* NAMESPACE = "ota";
+
+  // Upload in progress (async TCP task only)
+  volatile UploadState uploadState;
+  const void* owner;             // Request the upload belongs to
+  const esp_partition_t* target;
+  esp_ota_handle_t handle;
+  bool handleOpen;
+  mbedtls_sha256_context sha;
+  uint8_t expectedSha[32];
+  size_t expectedSize;
+  volatile size_t received;
+  unsigned long startedAt;
+  unsigned long lastChunkAt;
+  const char* error;             // Static string
+  bool unauthorized;             // begin() refused the signature
+  Stats stats;
+
+  // Boot health (loop() only)
+  BootState bootState;
+  unsigned long trialStart;
+  bool requireSensor;            // Sensor worked on the firmware that was replaced
+  volatile bool sensorHealthy;   // Last health report (saved with an upload)
+
+  bool fail(const char* message);
+  void rollback(const char* reason);
+
+public:
+  OtaUpdater()
+    : uploadState(UPLOAD_IDLE),
+      owner(nullptr),
+      target(nullptr),
+      handle(0),
+      handleOpen(false),
+      expectedSize(0),
+      received(0),
+      startedAt(0),
+      lastChunkAt(0),
+      error(""),
+      unauthorized(false),
+      bootState(BOOT_NORMAL),
+      trialStart(0),
+      requireSensor(false),
+      sensorHealthy(false) {
+    memset(&stats, 0, sizeof(stats));
+    memset(expectedSha, 0, sizeof(expectedSha));
+  }
+
+  // Count a trial boot and roll back a firmware that keeps rebooting
+  // (call first in setup(), before anything the new firmware could crash in)
+  void beginBoot();
+
+  // Report health from loop() (every iteration - cheap unless on trial)
+  void checkHealth(bool sensorRead, bool webServerUp, uint32_t loopIterations);
+
+  // Start an upload of size bytes; sha256Hex is the expected image hash,
+  // signatureHex its HMAC (see above)
+  // Returns false (with getError()) if another upload is running, the
+  // signature does not match or the parameters are invalid.
+  bool begin(const void* owner, size_t size, const char* sha256Hex, const char* signatureHex);
+
+  // Write the next chunk (chunks of other requests are ignored)
+  bool write(const void* owner, const uint8_t* data, size_t length);
+
+  // Verify the complete image and make it the boot partition
+  bool finish(const void* owner);
+
+  // The request went away before finish() (connection closed)
+  void abort(const void* owner);
+
+  // Why begin/write/finish failed for this request
+  const char* getError(const void* requester) const {
+    if (requester == owner) return error;
+    if (uploadState == UPLOAD_RECEIVING) return "Another upload is in progress";
+    return "No firmware received";
+  }
+
+  const char* getLastError() const { return error; }
+
+  // begin() refused this request's signature (HTTP 401)
+  bool isUnauthorized(const void* requester) const {
+    return requester == owner && unauthorized;
+  }
+
+  bool isBusy(const void* requester) const {
+    return uploadState == UPLOAD_RECEIVING && requester != owner;
+  }
+
+  UploadState getUploadState() const { return uploadState; }
+  BootState getBootState() const { return bootState; }
+  size_t getReceived() const { return received; }
+  size_t getExpectedSize() const { return expectedSize; }
+  const Stats& getStats() const { return stats; }
+
+  static const char* uploadStateName(UploadState state) {
+    switch (state) {
+      case UPLOAD_IDLE:      return "idle";
+      case UPLOAD_RECEIVING: return "receiving";
+      case UPLOAD_FAILED:    return "failed";
+      default:               return "?";
+    }
+  }
+
+  static const char* bootStateName(BootState state) {
+    switch (state) {
+      case BOOT_NORMAL:      return "normal";
+      case BOOT_TRIAL:       return "trial";
+      case BOOT_VERIFIED:    return "verified";
+      case BOOT_ROLLED_BACK: return "rolledBack";
+      default:               return "?";
+    }
+  }
+};
+
+// Global instance
+extern OtaUpdater otaUpdater;
+
+#endif // OTA_UPDATER_H
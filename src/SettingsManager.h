@@ -25,11 +25,36 @@ public:
     unsigned long weatherUpdateInterval;
     bool cubeLight;  // Ambient cube lighting
     uint8_t cubeLightBrightness;  // 0-255
+    int8_t setpointMode;  // -1 = manual, >= 0 = linked to station registry index
   };
   
   Settings currentSettings;
   
-  SettingsManager() {
+private:
+  // Settings as they are on flash - saveToEEPROM() only writes the keys
+  // whose value differs from these
+  Settings persisted;
+  bool persistedValid;
+  
+  // Deferred save (see requestSave)
+  bool savePending;
+  unsigned long firstRequestAt;
+  unsigned long lastRequestAt;
+  
+  // Statistics (flash wear)
+  volatile uint32_t keyWrites;          // NVS keys written
+  volatile uint32_t saves;              // saveToEEPROM() runs that wrote something
+  volatile uint32_t requestsCoalesced;  // requestSave() calls merged into a pending save
+  
+public:
+  SettingsManager()
+    : persistedValid(false),
+      savePending(false),
+      firstRequestAt(0),
+      lastRequestAt(0),
+      keyWrites(0),
+      saves(0),
+      requestsCoalesced(0) {
     // Initialize with default values from config.h
     loadDefaults();
   }
@@ -48,6 +73,7 @@ public:
     currentSettings.weatherUpdateInterval = WEATHER_UPDATE_INTERVAL;
     currentSettings.cubeLight = CUBE_LIGHT;
     currentSettings.cubeLightBrightness = CUBE_LIGHT_BRIGHTNESS;
+    currentSettings.setpointMode = -1;
   }
   
   // Initialize preferences - load from EEPROM or use defaults on first boot
@@ -75,27 +101,81 @@ public:
   }
   
   // Save current settings to EEPROM
+  // Only the keys that changed since the last save (or load) are written.
   void saveToEEPROM() {
+    savePending = false;
+    const Settings& s = currentSettings;
+    const Settings& p = persisted;
+    bool all = !persistedValid;
+    
     preferences.begin(NAMESPACE, false);
+    uint32_t written = 0;
     
-    preferences.putFloat("setpoint", currentSettings.manualSetpoint);
-    preferences.putFloat("reactivateT", currentSettings.reactivateTemp);
-    preferences.putULong("freezeDur", currentSettings.durationGlacierFreezing);
-    preferences.putULong("reactTimer", currentSettings.reactivateTimer);
-    preferences.putUChar("neoBright", currentSettings.neopixelBrightness);
-    preferences.putUShort("fadeDur", currentSettings.ledFadeTotalTime);
-    preferences.putULong("tempInt", currentSettings.tempReadInterval);
-    preferences.putUChar("audioVol", currentSettings.audioVolume);
-    preferences.putUChar("dropTrack", currentSettings.dropSoundTrack);
-    preferences.putULong("weatherInt", currentSettings.weatherUpdateInterval);
-    preferences.putBool("cubeLight", currentSettings.cubeLight);
-    preferences.putUChar("cubeBright", currentSettings.cubeLightBrightness);
-    preferences.putBool(INITIALIZED_KEY, true);  // Mark as initialized
+    if (all || s.manualSetpoint != p.manualSetpoint) { preferences.putFloat("setpoint", s.manualSetpoint); written++; }
+    if (all || s.reactivateTemp != p.reactivateTemp) { preferences.putFloat("reactivateT", s.reactivateTemp); written++; }
+    if (all || s.durationGlacierFreezing != p.durationGlacierFreezing) { preferences.putULong("freezeDur", s.durationGlacierFreezing); written++; }
+    if (all || s.reactivateTimer != p.reactivateTimer) { preferences.putULong("reactTimer", s.reactivateTimer); written++; }
+    if (all || s.neopixelBrightness != p.neopixelBrightness) { preferences.putUChar("neoBright", s.neopixelBrightness); written++; }
+    if (all || s.ledFadeTotalTime != p.ledFadeTotalTime) { preferences.putUShort("fadeDur", s.ledFadeTotalTime); written++; }
+    if (all || s.tempReadInterval != p.tempReadInterval) { preferences.putULong("tempInt", s.tempReadInterval); written++; }
+    if (all || s.audioVolume != p.audioVolume) { preferences.putUChar("audioVol", s.audioVolume); written++; }
+    if (all || s.dropSoundTrack != p.dropSoundTrack) { preferences.putUChar("dropTrack", s.dropSoundTrack); written++; }
+    if (all || s.weatherUpdateInterval != p.weatherUpdateInterval) { preferences.putULong("weatherInt", s.weatherUpdateInterval); written++; }
+    if (all || s.cubeLight != p.cubeLight) { preferences.putBool("cubeLight", s.cubeLight); written++; }
+    if (all || s.cubeLightBrightness != p.cubeLightBrightness) { preferences.putUChar("cubeBright", s.cubeLightBrightness); written++; }
+    if (all || s.setpointMode != p.setpointMode) { preferences.putChar("spMode", s.setpointMode); written++; }
+    if (all) {
+      preferences.putBool(INITIALIZED_KEY, true);  // Mark as initialized
+      written++;
+    }
     
     preferences.end();
-    Serial.println("Settings saved to EEPROM");
+    persisted = currentSettings;
+    persistedValid = true;
+    
+    if (written > 0) {
+      keyWrites += written;
+      saves++;
+      Serial.printf("Settings saved to EEPROM (%lu keys)\n", (unsigned long)written);
+    }
+  }
+  
+  // Schedule a save after changing currentSettings (loop() only)
+  // The write happens in update() once no further change came in for
+  // SETTINGS_SAVE_DELAY, so a burst of changes (a dragged slider) costs one
+  // save - at most SETTINGS_SAVE_MAX_DELAY after the first change.
+  void requestSave() {
+    unsigned long now = millis();
+    if (savePending) {
+      requestsCoalesced++;
+    } else {
+      firstRequestAt = now;
+      savePending = true;
+    }
+    lastRequestAt = now;
+  }
+  
+  // Write a pending save when it is due (call from loop())
+  void update() {
+    if (!savePending) return;
+    unsigned long now = millis();
+    if (now - lastRequestAt >= SETTINGS_SAVE_DELAY || now - firstRequestAt >= SETTINGS_SAVE_MAX_DELAY) {
+      saveToEEPROM();
+    }
   }
   
+  // Write a pending save now (before a restart)
+  void flush() {
+    if (savePending) saveToEEPROM();
+  }
+  
+  bool isSavePending() const { return savePending; }
+  
+  // Statistics
+  uint32_t getKeyWrites() const { return keyWrites; }
+  uint32_t getSaves() const { return saves; }
+  uint32_t getRequestsCoalesced() const { return requestsCoalesced; }
+  
   // Load settings from EEPROM
   void loadFromEEPROM() {
     preferences.begin(NAMESPACE, true); // Read-only mode
@@ -112,8 +192,11 @@ public:
     currentSettings.weatherUpdateInterval = preferences.getULong("weatherInt", WEATHER_UPDATE_INTERVAL);
     currentSettings.cubeLight = preferences.getBool("cubeLight", CUBE_LIGHT);
     currentSettings.cubeLightBrightness = preferences.getUChar("cubeBright", CUBE_LIGHT_BRIGHTNESS);
+    currentSettings.setpointMode = preferences.getChar("spMode", -1);
     
     preferences.end();
+    persisted = currentSettings;
+    persistedValid = true;
     
     Serial.println("Settings loaded from EEPROM:");
     printSettings();
@@ -140,7 +223,11 @@ public:
     Serial.printf("  Weather Update Interval: %lu ms\n", currentSettings.weatherUpdateInterval);
     Serial.printf("  Cube Light: %s\n", currentSettings.cubeLight ? "ON" : "OFF");
     Serial.printf("  Cube Light Brightness: %d\n", currentSettings.cubeLightBrightness);
+    Serial.printf("  Setpoint Mode: %d\n", currentSettings.setpointMode);
   }
 };
 
+// Global instance
+extern SettingsManager settingsManager;
+
 #endif // SETTINGS_MANAGER_H
@@ -0,0 +1,44 @@
+#include "StationRegistry.h"
+#include "WeatherStationData.h"
+
+// Global instance
+StationRegistry stationRegistry;
+
+// Reset to the compile-time defaults (WeatherStationData.h)
+void StationRegistry::loadDefaults() {
+  portENTER_CRITICAL(&lock);
+  memset(table, 0, sizeof(table));
+  int count = min(NUM_DEFAULT_STATIONS, WEATHER_MAX_STATIONS);
+  for (int i = 0; i < count; i++) {
+    const StationDefault& d = defaultStations[i];
+    WeatherStation& s = table[i];
+    copyString(s.name, d.name, sizeof(s.name));
+    copyString(s.timezone, d.timezone, sizeof(s.timezone));
+    s.lat = d.lat;
+    s.lon = d.lon;
+    s.temperature = d.temperature;
+    s.humidity = d.humidity;
+    s.dewPoint = d.dewPoint;
+    s.priority = d.priority;
+    s.displayed = d.displayed;
+  }
+  numStations = count;
+  localIndex = LOCAL_SHENZHEN < count ? LOCAL_SHENZHEN : -1;
+  version++;
+  portEXIT_CRITICAL(&lock);
+}
+
+// Seed readings of stations that match a default location with its presets
+void StationRegistry::applyPresets() {
+  for (int i = 0; i < numStations; i++) {
+    for (int j = 0; j < NUM_DEFAULT_STATIONS; j++) {
+      const StationDefault& d = defaultStations[j];
+      if (fabsf(table[i].lat - d.lat) < 0.001f && fabsf(table[i].lon - d.lon) < 0.001f) {
+        table[i].temperature = d.temperature;
+        table[i].humidity = d.humidity;
+        table[i].dewPoint = d.dewPoint;
+        break;
+      }
+    }
+  }
+}
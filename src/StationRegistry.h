@@ -0,0 +1,258 @@
+#ifndef STATION_REGISTRY_H
+#define STATION_REGISTRY_H
+
+#include <Preferences.h>
+#include <math.h>
+#include "config.h"
+#include "WeatherStation.h"
+
+// Runtime table of weather stations (replaces the compile-time stations[])
+// Loaded from flash at boot (factory defaults from WeatherStationData.h on
+// first boot), editable over the web API and persisted on every edit.
+//
+// Only referenced stations are fetched: the station the setpoint is linked
+// to, the local station and stations marked as displayed. Each station has
+// its own fetch interval and priority.
+class StationRegistry {
+private:
+  Preferences preferences;
+  const char* NAMESPACE = "stations";
+  const char* TABLE_KEY = "table";
+  const char* LOCAL_KEY = "local";
+
+  // Persisted configuration of one station (readings live in WeatherCache)
+  struct Entry {
+    char name[WEATHER_STATION_NAME_LEN];
+    char timezone[WEATHER_STATION_TZ_LEN];
+    float lat;
+    float lon;
+    uint32_t fetchInterval;
+    uint8_t priority;
+    uint8_t displayed;
+  };
+
+  WeatherStation table[WEATHER_MAX_STATIONS];
+  int numStations;
+  int localIndex;
+  volatile int linkedIndex;      // Station the setpoint follows (-1 = manual)
+  volatile uint32_t version;     // Bumped on every edit (fetcher resyncs)
+  portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;  // Edits vs. fetcher copies
+
+  static void copyString(char* dst, const char* src, size_t size) {
+    strncpy(dst, src ? src : "", size - 1);
+    dst[size - 1] = '\0';
+  }
+
+public:
+  StationRegistry()
+    : numStations(0),
+      localIndex(-1),
+      linkedIndex(-1),
+      version(0) {
+    memset(table, 0, sizeof(table));
+  }
+
+  // Load the registry from flash, or the factory defaults on first boot
+  bool begin() {
+    if (!load()) {
+      Serial.println("Station registry: using defaults from WeatherStationData.h");
+      loadDefaults();
+      save();
+    }
+    return numStations > 0;
+  }
+
+  // Reset to the compile-time defaults (not saved)
+  void loadDefaults();
+
+  // Seed readings of known stations with their presets (until first fetch)
+  void applyPresets();
+
+  // Load station configuration from flash - returns false if none stored
+  bool load() {
+    Entry entries[WEATHER_MAX_STATIONS];
+
+    if (!preferences.begin(NAMESPACE, true)) {  // Read-only mode
+      return false;
+    }
+    size_t bytes = preferences.getBytes(TABLE_KEY, entries, sizeof(entries));
+    int local = preferences.getInt(LOCAL_KEY, -1);
+    preferences.end();
+
+    int count = bytes / sizeof(Entry);
+    if (count == 0) return false;
+
+    portENTER_CRITICAL(&lock);
+    memset(table, 0, sizeof(table));
+    for (int i = 0; i < count; i++) {
+      WeatherStation& s = table[i];
+      copyString(s.name, entries[i].name, sizeof(s.name));
+      copyString(s.timezone, entries[i].timezone, sizeof(s.timezone));
+      s.lat = entries[i].lat;
+      s.lon = entries[i].lon;
+      s.fetchInterval = entries[i].fetchInterval;
+      s.priority = entries[i].priority;
+      s.displayed = entries[i].displayed;
+    }
+    numStations = count;
+    localIndex = (local >= 0 && local < count) ? local : -1;
+    applyPresets();
+    version++;
+    portEXIT_CRITICAL(&lock);
+
+    Serial.printf("Station registry: loaded %d stations\n", count);
+    return true;
+  }
+
+  // Persist station configuration (not readings)
+  void save() {
+    Entry entries[WEATHER_MAX_STATIONS];
+    memset(entries, 0, sizeof(entries));
+
+    portENTER_CRITICAL(&lock);
+    int count = numStations;
+    int local = localIndex;
+    for (int i = 0; i < count; i++) {
+      const WeatherStation& s = table[i];
+      copyString(entries[i].name, s.name, sizeof(entries[i].name));
+      copyString(entries[i].timezone, s.timezone, sizeof(entries[i].timezone));
+      entries[i].lat = s.lat;
+      entries[i].lon = s.lon;
+      entries[i].fetchInterval = s.fetchInterval;
+      entries[i].priority = s.priority;
+      entries[i].displayed = s.displayed;
+    }
+    portEXIT_CRITICAL(&lock);
+
+    preferences.begin(NAMESPACE, false);
+    preferences.putBytes(TABLE_KEY, entries, count * sizeof(Entry));
+    preferences.putInt(LOCAL_KEY, local);
+    preferences.end();
+  }
+
+  // Add (index < 0) or update a station's configuration
+  // Readings are kept when the coordinates did not change.
+  // Returns the station index, or -1 if the registry is full / index invalid.
+  int upsert(int index, const char* name, float lat, float lon, const char* timezone,
+             uint32_t fetchInterval, uint8_t priority, bool displayed) {
+    portENTER_CRITICAL(&lock);
+    if (index < 0) {
+      if (numStations >= WEATHER_MAX_STATIONS) {
+        portEXIT_CRITICAL(&lock);
+        return -1;
+      }
+      index = numStations++;
+      memset(&table[index], 0, sizeof(WeatherStation));
+    } else if (index >= numStations) {
+      portEXIT_CRITICAL(&lock);
+      return -1;
+    }
+
+    WeatherStation& s = table[index];
+    bool moved = fabsf(s.lat - lat) > 0.0001f || fabsf(s.lon - lon) > 0.0001f;
+    copyString(s.name, name, sizeof(s.name));
+    copyString(s.timezone, timezone, sizeof(s.timezone));
+    s.lat = lat;
+    s.lon = lon;
+    s.fetchInterval = fetchInterval;
+    s.priority = priority;
+    s.displayed = displayed;
+    if (moved) {
+      // New location - old readings and forecast no longer apply
+      s.updatedAt = 0;
+      s.fetchedEpoch = 0;
+      memset(&s.forecast, 0, sizeof(s.forecast));
+    }
+    version++;
+    portEXIT_CRITICAL(&lock);
+    return index;
+  }
+
+  // Remove a station - later stations shift down by one
+  bool remove(int index) {
+    portENTER_CRITICAL(&lock);
+    if (index < 0 || index >= numStations) {
+      portEXIT_CRITICAL(&lock);
+      return false;
+    }
+    for (int i = index; i < numStations - 1; i++) {
+      table[i] = table[i + 1];
+    }
+    numStations--;
+    if (localIndex == index) {
+      localIndex = -1;
+    } else if (localIndex > index) {
+      localIndex--;
+    }
+    version++;
+    portEXIT_CRITICAL(&lock);
+    return true;
+  }
+
+  // Copy the whole table (for the weather task) - consistent with edits
+  int copyTo(WeatherStation* out, uint32_t& copiedVersion) {
+    portENTER_CRITICAL(&lock);
+    int count = numStations;
+    for (int i = 0; i < count; i++) {
+      out[i] = table[i];
+    }
+    copiedVersion = version;
+    portEXIT_CRITICAL(&lock);
+    return count;
+  }
+
+  // Copy the table with the local and linked station (web task) - consistent
+  // with edits, which only loop() makes
+  int copyTo(WeatherStation* out, int& local, int& linked) {
+    portENTER_CRITICAL(&lock);
+    int count = numStations;
+    for (int i = 0; i < count; i++) {
+      out[i] = table[i];
+    }
+    local = localIndex;
+    linked = linkedIndex;
+    portEXIT_CRITICAL(&lock);
+    return count;
+  }
+
+  // Table access (loop() - the owner of station readings)
+  int count() const { return numStations; }
+  WeatherStation* data() { return table; }
+  WeatherStation& at(int index) { return table[index]; }
+  bool isValidIndex(int index) const { return index >= 0 && index < numStations; }
+  uint32_t getVersion() const { return version; }
+
+  // Local station (reference for the installation site)
+  int getLocalIndex() const { return localIndex; }
+  void setLocalIndex(int index) {
+    portENTER_CRITICAL(&lock);
+    localIndex = isValidIndex(index) ? index : -1;
+    version++;
+    portEXIT_CRITICAL(&lock);
+  }
+
+  // Station the setpoint is linked to (-1 = manual) - fetched even if hidden
+  int getLinkedIndex() const { return linkedIndex; }
+  void setLinkedIndex(int index) {
+    if (linkedIndex != index) {
+      linkedIndex = index;
+      version++;
+    }
+  }
+
+  // Should this station be fetched?
+  bool isReferenced(int index) const {
+    if (!isValidIndex(index)) return false;
+    return index == linkedIndex || index == localIndex || table[index].displayed;
+  }
+
+  // Effective fetch interval of a station
+  static uint32_t fetchIntervalOf(const WeatherStation& station) {
+    return station.fetchInterval ? station.fetchInterval : WEATHER_UPDATE_INTERVAL;
+  }
+};
+
+// Global instance
+extern StationRegistry stationRegistry;
+
+#endif // STATION_REGISTRY_H
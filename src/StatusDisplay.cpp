@@ -0,0 +1,4 @@
+#include "StatusDisplay.h"
+
+// Global instance
+StatusDisplay statusDisplay;
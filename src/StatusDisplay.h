@@ -0,0 +1,311 @@
+#ifndef STATUS_DISPLAY_H
+#define STATUS_DISPLAY_H
+
+#include <M5Unified.h>
+#include <math.h>
+#include "config.h"
+
+// Off-screen rendering of the LCD status screen.
+// The whole frame is drawn into an M5Canvas sprite (no flicker) and pushed to
+// the panel over DMA, so the CPU returns to loop() while the SPI transfer runs.
+// A frame is only rendered when one of the displayed values actually changed.
+//
+// Layout (128x128):
+//   - Header: thermostat state, drops, plate temperature, setpoint/reactivate
+//   - Graph:  scrolling plot of plate temperature against setpoint and
+//             reactivate temperature, with drop markers. Each new sample
+//             scrolls the graph sprite one pixel and draws a single column.
+class StatusDisplay {
+public:
+  // Values shown in the header (compared at display precision)
+  struct Frame {
+    bool cooling;
+    float setpoint;
+    float reactivateTemp;
+    float peltierTemp;
+    int dropCount;
+  };
+
+private:
+  static const int HEADER_HEIGHT = 34;
+  static const int GRAPH_MAX_WIDTH = 128;
+  static const int GRAPH_MARGIN_TENTHS = 20;  // 2 °C headroom above/below
+
+  // One graph column (temperatures in tenths of °C)
+  struct Sample {
+    int16_t plate;
+    int16_t setpoint;
+    int16_t reactivate;
+    bool drop;
+  };
+
+  M5Canvas canvas;
+  M5Canvas graph;
+  bool spriteReady;
+  bool graphReady;
+  bool pushPending;      // DMA transfer in flight (transaction still open)
+  bool hasLastFrame;
+  bool graphDirty;       // Graph gained a column since the last push
+  Frame lastFrame;
+  unsigned long framesRendered;
+  unsigned long framesSkipped;
+
+  // Sample history (ring buffer, one entry per graph column)
+  Sample history[GRAPH_MAX_WIDTH];
+  int historyHead;       // Index of the next slot to write
+  int historyCount;
+  bool dropPending;      // Drop seen since the last sample
+  int16_t rangeMin;      // Current vertical scale (tenths of °C)
+  int16_t rangeMax;
+
+  // Temperatures are printed with one decimal - compare at that precision
+  static long tenths(float value) {
+    return lroundf(value * 10.0f);
+  }
+
+  static bool sameFrame(const Frame& a, const Frame& b) {
+    return a.cooling == b.cooling &&
+           tenths(a.setpoint) == tenths(b.setpoint) &&
+           tenths(a.reactivateTemp) == tenths(b.reactivateTemp) &&
+           tenths(a.peltierTemp) == tenths(b.peltierTemp) &&
+           a.dropCount == b.dropCount;
+  }
+
+  // Finish the previous DMA push before the sprite buffer is touched again
+  void finishPush() {
+    if (pushPending) {
+      M5.Display.waitDMA();
+      M5.Display.endWrite();
+      pushPending = false;
+    }
+  }
+
+  // Get sample by age (0 = newest)
+  const Sample& sampleAt(int age) const {
+    int index = (historyHead - 1 - age + GRAPH_MAX_WIDTH) % GRAPH_MAX_WIDTH;
+    return history[index];
+  }
+
+  // Map a temperature (tenths) to a graph row
+  int rowFor(int16_t value) const {
+    int h = graph.height() - 1;
+    long span = rangeMax - rangeMin;
+    if (span <= 0) return h / 2;
+    long row = h - ((long)(value - rangeMin) * h) / span;
+    if (row < 0) row = 0;
+    if (row > h) row = h;
+    return (int)row;
+  }
+
+  // Recompute the vertical scale from the whole history
+  // Returns true if the scale changed (graph must be redrawn)
+  bool updateRange() {
+    int16_t lo = INT16_MAX;
+    int16_t hi = INT16_MIN;
+    for (int age = 0; age < historyCount; age++) {
+      const Sample& s = sampleAt(age);
+      lo = min(lo, min(s.plate, min(s.setpoint, s.reactivate)));
+      hi = max(hi, max(s.plate, max(s.setpoint, s.reactivate)));
+    }
+    lo -= GRAPH_MARGIN_TENTHS;
+    hi += GRAPH_MARGIN_TENTHS;
+
+    // Only rescale when a value leaves the current range or the range
+    // became much too wide - otherwise keep per-sample cost constant
+    bool outside = (lo < rangeMin || hi > rangeMax);
+    bool tooWide = (rangeMax - rangeMin) > 2 * (hi - lo);
+    if (!outside && !tooWide) return false;
+
+    rangeMin = lo;
+    rangeMax = hi;
+    return true;
+  }
+
+  // Draw one column at x for the sample and its predecessor (may be null)
+  void drawColumn(int x, const Sample& s, const Sample* prev) {
+    int h = graph.height();
+    graph.drawFastVLine(x, 0, h, BLACK);
+
+    // 0 °C reference (dotted)
+    if (rangeMin < 0 && rangeMax > 0 && (x % 4) == 0) {
+      graph.drawPixel(x, rowFor(0), DARKGREY);
+    }
+
+    if (s.drop) {
+      graph.drawFastVLine(x, 0, h, MAGENTA);
+    }
+
+    graph.drawPixel(x, rowFor(s.setpoint), CYAN);
+    graph.drawPixel(x, rowFor(s.reactivate), ORANGE);
+
+    int y = rowFor(s.plate);
+    if (prev) {
+      graph.drawLine(x - 1, rowFor(prev->plate), x, y, YELLOW);
+    } else {
+      graph.drawPixel(x, y, YELLOW);
+    }
+  }
+
+  // Full graph redraw from history (only after a rescale)
+  void redrawGraph() {
+    graph.fillScreen(BLACK);
+    int w = graph.width();
+    int count = min(historyCount, w);
+    for (int age = count - 1; age >= 0; age--) {
+      const Sample* prev = (age + 1 < count) ? &sampleAt(age + 1) : nullptr;
+      drawColumn(w - 1 - age, sampleAt(age), prev);
+    }
+  }
+
+  // Draw the header lines into any LovyanGFX target (sprite or panel)
+  template <typename GFX>
+  static void drawHeader(GFX& gfx, const Frame& frame) {
+    gfx.fillRect(0, 0, gfx.width(), HEADER_HEIGHT, BLACK);
+    gfx.setTextSize(1);
+
+    // Thermostat state and drop count
+    gfx.setCursor(2, 2);
+    gfx.setTextColor(frame.cooling ? GREEN : RED);
+    gfx.print(frame.cooling ? "ON " : "OFF");
+    gfx.setTextColor(WHITE);
+    gfx.print("  Drops: ");
+    gfx.setTextColor(MAGENTA);
+    gfx.printf("%d", frame.dropCount);
+
+    // Plate temperature
+    gfx.setCursor(2, 12);
+    gfx.setTextColor(WHITE);
+    gfx.print("Peltier: ");
+    gfx.setTextColor(YELLOW);
+    gfx.printf("%.1f C", frame.peltierTemp);
+
+    // Setpoint and reactivate temperature
+    gfx.setCursor(2, 22);
+    gfx.setTextColor(WHITE);
+    gfx.print("Set ");
+    gfx.setTextColor(CYAN);
+    gfx.printf("%.1f", frame.setpoint);
+    gfx.setTextColor(WHITE);
+    gfx.print(" Re ");
+    gfx.setTextColor(ORANGE);
+    gfx.printf("%.1f", frame.reactivateTemp);
+
+    gfx.drawFastHLine(0, HEADER_HEIGHT - 1, gfx.width(), DARKGREY);
+  }
+
+public:
+  StatusDisplay()
+    : canvas(&M5.Display),
+      graph(&canvas),
+      spriteReady(false),
+      graphReady(false),
+      pushPending(false),
+      hasLastFrame(false),
+      graphDirty(false),
+      lastFrame{false, 0.0, 0.0, 0.0, 0},
+      framesRendered(0),
+      framesSkipped(0),
+      historyHead(0),
+      historyCount(0),
+      dropPending(false),
+      rangeMin(0),
+      rangeMax(0) {
+  }
+
+  // Allocate the full-screen and graph sprites (call after M5.begin())
+  // Returns false if the sprite could not be allocated - drawing then falls
+  // back to direct (flickering) rendering on the panel, without the graph.
+  bool begin() {
+    canvas.setColorDepth(16);
+    canvas.setPsram(false);  // DMA needs the buffer in internal RAM
+    spriteReady = (canvas.createSprite(M5.Display.width(), M5.Display.height()) != nullptr);
+
+    if (spriteReady) {
+      int graphWidth = min((int)M5.Display.width(), (int)GRAPH_MAX_WIDTH);
+      graph.setColorDepth(16);
+      graph.setPsram(false);
+      graphReady = (graph.createSprite(graphWidth, M5.Display.height() - HEADER_HEIGHT) != nullptr);
+      if (graphReady) {
+        graph.setBaseColor(BLACK);  // Color revealed by scroll()
+        graph.fillScreen(BLACK);
+      }
+    }
+
+    hasLastFrame = false;
+    return spriteReady;
+  }
+
+  // Mark a drop - shown as a vertical marker on the next graph column
+  void markDrop() {
+    dropPending = true;
+  }
+
+  // Append one sample to the graph: scroll by one pixel and draw one column
+  void addSample(float plateTemp, float setpoint, float reactivateTemp) {
+    Sample s;
+    s.plate = (int16_t)tenths(plateTemp);
+    s.setpoint = (int16_t)tenths(setpoint);
+    s.reactivate = (int16_t)tenths(reactivateTemp);
+    s.drop = dropPending;
+    dropPending = false;
+
+    history[historyHead] = s;
+    historyHead = (historyHead + 1) % GRAPH_MAX_WIDTH;
+    if (historyCount < GRAPH_MAX_WIDTH) historyCount++;
+
+    if (!graphReady) return;
+
+    finishPush();  // graph is composed into canvas, which may be in flight
+    if (updateRange()) {
+      redrawGraph();
+    } else {
+      graph.scroll(-1, 0);
+      const Sample* prev = (historyCount > 1) ? &sampleAt(1) : nullptr;
+      drawColumn(graph.width() - 1, s, prev);
+    }
+    graphDirty = true;
+  }
+
+  // Render and push a frame if any displayed value changed or the graph moved
+  // Returns true if the screen was redrawn
+  bool update(const Frame& frame) {
+    bool headerChanged = !(hasLastFrame && sameFrame(frame, lastFrame));
+    if (!headerChanged && !graphDirty) {
+      framesSkipped++;
+      return false;
+    }
+    lastFrame = frame;
+    hasLastFrame = true;
+    framesRendered++;
+
+    if (!spriteReady) {
+      if (headerChanged) drawHeader(M5.Display, frame);
+      return true;
+    }
+
+    finishPush();
+    if (headerChanged) drawHeader(canvas, frame);
+    if (graphDirty && graphReady) {
+      graph.pushSprite(0, HEADER_HEIGHT);  // Compose into the full-screen canvas
+      graphDirty = false;
+    }
+
+    // Keep the transaction open until the next frame so the DMA transfer
+    // runs in the background while loop() carries on
+    M5.Display.startWrite();
+    M5.Display.pushImageDMA(0, 0, canvas.width(), canvas.height(),
+                            (const lgfx::swap565_t*)canvas.getBuffer());
+    pushPending = true;
+    return true;
+  }
+
+  // Statistics
+  bool isSpriteReady() const { return spriteReady; }
+  unsigned long getFramesRendered() const { return framesRendered; }
+  unsigned long getFramesSkipped() const { return framesSkipped; }
+};
+
+// Global instance
+extern StatusDisplay statusDisplay;
+
+#endif // STATUS_DISPLAY_H
@@ -0,0 +1,59 @@
+#include "SystemState.h"
+#include <esp_system.h>
+
+// Global instance
+SystemState systemState;
+
+uint32_t SystemState::changedParts(const Snapshot& a, const Snapshot& b) {
+  uint32_t changed = 0;
+
+  if (a.cooling != b.cooling || a.setpoint != b.setpoint || a.reactivateTemp != b.reactivateTemp) {
+    changed |= 1u << PART_THERMOSTAT;
+  }
+  if (a.peltierTemp != b.peltierTemp) changed |= 1u << PART_PELTIER_TEMP;
+  if (a.dropCount != b.dropCount) changed |= 1u << PART_DROP_COUNT;
+  if (a.setpointMode != b.setpointMode) changed |= 1u << PART_SETPOINT_MODE;
+  if (a.manualSetpoint != b.manualSetpoint) changed |= 1u << PART_MANUAL_SETPOINT;
+
+  if (a.hwTempSensor != b.hwTempSensor || a.hwDropDetector != b.hwDropDetector ||
+      a.hwNeoPixel != b.hwNeoPixel || a.hwAudioPlayer != b.hwAudioPlayer ||
+      a.hwWiFi != b.hwWiFi || a.hwWebServer != b.hwWebServer) {
+    changed |= 1u << PART_HARDWARE;
+  }
+
+  // Station ages only count in whole minutes (the dashboard shows minutes),
+  // otherwise the weather part would change every second
+  if (a.numStations != b.numStations) {
+    changed |= 1u << PART_WEATHER;
+  } else {
+    for (int i = 0; i < a.numStations; i++) {
+      const StationView& x = a.stations[i];
+      const StationView& y = b.stations[i];
+      if (strcmp(x.name, y.name) != 0 || x.temperature != y.temperature ||
+          x.humidity != y.humidity || x.stale != y.stale || x.referenced != y.referenced ||
+          (x.ageSec < 0) != (y.ageSec < 0) || x.ageSec / 60 != y.ageSec / 60) {
+        changed |= 1u << PART_WEATHER;
+        break;
+      }
+    }
+  }
+
+  if (a.networkHash != b.networkHash) changed |= 1u << PART_NETWORK;
+  if (a.weatherClientHash != b.weatherClientHash) changed |= 1u << PART_WEATHER_CLIENT;
+
+  if (a.freezeDuration != b.freezeDuration || a.reactivateTimer != b.reactivateTimer ||
+      a.ledFadeTime != b.ledFadeTime || a.ledBrightness != b.ledBrightness ||
+      a.cubeLight != b.cubeLight || a.cubeLightBrightness != b.cubeLightBrightness) {
+    changed |= 1u << PART_SETTINGS;
+  }
+
+  if (a.historyHash != b.historyHash) changed |= 1u << PART_HISTORY;
+
+  return changed;
+}
+
+// Random start in the lower half of the range (never 0 - that means
+// "nothing published yet")
+uint32_t SystemState::firstVersion() {
+  return (esp_random() >> 1) | 1;
+}
@@ -0,0 +1,214 @@
+#ifndef SYSTEM_STATE_H
+#define SYSTEM_STATE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "config.h"
+
+// Snapshot of the control state, published by loop() for other readers
+//
+// The state lives in main.cpp globals and component members that only loop()
+// writes. Other tasks (web handlers on the async TCP task) must not read them
+// directly - a float or a group of fields can change halfway through. loop()
+// copies everything once per iteration into a Snapshot and publishes it under
+// a sequence lock: the sequence number is odd while a copy is being written,
+// and a reader retries until it copied the same even number before and after.
+// The writer never waits and readers never take a lock.
+class SystemState {
+public:
+  // Timed sections of loop() (see main.cpp)
+  enum LoopStage {
+    STAGE_COMMANDS,    // Web commands
+    STAGE_CONTROL,     // Sensor, thermostat, drop handling
+    STAGE_OUTPUTS,     // LED fades and cube light
+    STAGE_NETWORK,     // WiFi state machine, weather apply, interpolation
+    STAGE_PUBLISH,     // State snapshot and history log
+    STAGE_DISPLAY,     // LCD frame
+    STAGE_PUSH,        // SSE updates
+    NUM_LOOP_STAGES
+  };
+
+  static const char* stageName(int stage) {
+    switch (stage) {
+      case STAGE_COMMANDS: return "commands";
+      case STAGE_CONTROL:  return "control";
+      case STAGE_OUTPUTS:  return "outputs";
+      case STAGE_NETWORK:  return "network";
+      case STAGE_PUBLISH:  return "publish";
+      case STAGE_DISPLAY:  return "display";
+      case STAGE_PUSH:     return "push";
+      default:             return "?";
+    }
+  }
+
+  // Parts of the snapshot with their own version (see publish())
+  // One per versioned top-level key of /api/status. Network, weather client
+  // and history are read live by the web task; loop() publishes a
+  // fingerprint of them so changes still bump their version.
+  enum Part {
+    PART_THERMOSTAT,
+    PART_PELTIER_TEMP,
+    PART_DROP_COUNT,
+    PART_SETPOINT_MODE,
+    PART_MANUAL_SETPOINT,
+    PART_HARDWARE,
+    PART_WEATHER,
+    PART_NETWORK,
+    PART_WEATHER_CLIENT,
+    PART_SETTINGS,
+    PART_HISTORY,
+    NUM_PARTS
+  };
+
+  // Weather station as shown on the dashboard
+  struct StationView {
+    char name[WEATHER_STATION_NAME_LEN];
+    float temperature;
+    float humidity;
+    long ageSec;               // -1 = unknown
+    bool stale;
+    bool referenced;           // Being fetched
+  };
+
+  struct Snapshot {
+    uint32_t iteration;        // loop() iteration that published it
+    unsigned long publishedAt; // millis()
+
+    // Versions (set by publish() - ignored in the snapshot passed to it)
+    uint32_t version;              // Latest partVersion
+    uint32_t partVersion[NUM_PARTS];
+
+    // Thermostat
+    bool cooling;
+    float setpoint;
+    float reactivateTemp;
+    uint64_t coolingMs;        // Total Peltier on-time
+    uint32_t transitions;      // Peltier on/off switches
+
+    // Sensors and control
+    float peltierTemp;
+    int dropCount;
+    int setpointMode;          // -1 = manual, >= 0 = station index
+    float manualSetpoint;
+    bool systemRunning;
+
+    // Hardware status
+    bool hwTempSensor;
+    bool hwDropDetector;
+    bool hwNeoPixel;
+    bool hwAudioPlayer;
+    bool hwWiFi;
+    bool hwWebServer;
+
+    // Settings
+    unsigned long freezeDuration;   // ms
+    unsigned long reactivateTimer;  // ms
+    uint16_t ledFadeTime;           // ms
+    uint8_t ledBrightness;
+    bool cubeLight;
+    uint8_t cubeLightBrightness;
+
+    // Weather stations
+    int numStations;
+    StationView stations[WEATHER_MAX_STATIONS];
+
+    // Fingerprints of the state read live (network, weather client, history)
+    uint32_t networkHash;
+    uint32_t weatherClientHash;
+    uint32_t historyHash;
+
+    // loop() timing (totals since boot; max = slowest single pass)
+    uint64_t stageUs[NUM_LOOP_STAGES];
+    uint32_t stageMaxUs[NUM_LOOP_STAGES];
+  };
+
+private:
+  static const int SPIN_LIMIT = 64;  // Retries before yielding to the writer
+
+  Snapshot current;
+  volatile uint32_t sequence;  // Odd while loop() is writing
+
+  // Parts that differ between two snapshots (bit per Part)
+  static uint32_t changedParts(const Snapshot& a, const Snapshot& b);
+  static uint32_t firstVersion();
+
+  // Statistics
+  volatile uint32_t publishes;
+  volatile uint32_t readRetries;  // Reads that overlapped a publish
+
+public:
+  SystemState()
+    : sequence(0),
+      publishes(0),
+      readRetries(0) {
+    memset(&current, 0, sizeof(current));
+  }
+
+  // FNV-1a hash, chainable over several fields
+  static uint32_t fingerprint(const void* data, size_t length, uint32_t hash = 2166136261u) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < length; i++) {
+      hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+  }
+
+  // Publish a new snapshot (loop() only - single writer)
+  // Every publish that changes a part bumps the version and stamps it on the
+  // changed parts, so a reader holding version v knows which parts are newer.
+  // The first version is random: a client still holding a version from before
+  // a reboot almost certainly falls outside the new range and gets everything.
+  void publish(const Snapshot& snapshot) {
+    uint32_t version = current.version;
+    uint32_t partVersion[NUM_PARTS];
+    memcpy(partVersion, current.partVersion, sizeof(partVersion));
+    uint32_t changed = (version == 0) ? (1u << NUM_PARTS) - 1 : changedParts(current, snapshot);
+    if (changed != 0) {
+      version = (version == 0) ? firstVersion() : version + 1;
+      for (int i = 0; i < NUM_PARTS; i++) {
+        if (changed & (1u << i)) partVersion[i] = version;
+      }
+    }
+
+    uint32_t seq = sequence;
+    sequence = seq + 1;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    memcpy(&current, &snapshot, sizeof(current));
+    current.version = version;
+    memcpy(current.partVersion, partVersion, sizeof(partVersion));
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    sequence = seq + 2;
+    publishes++;
+  }
+
+  // Copy the latest snapshot (any task)
+  // Spins while a publish is in progress; if the writer was preempted by the
+  // reader's task on the same core, yields a tick so it can finish.
+  void read(Snapshot& out) {
+    int spins = 0;
+    while (true) {
+      uint32_t before = sequence;
+      __atomic_thread_fence(__ATOMIC_SEQ_CST);
+      if ((before & 1) == 0) {
+        memcpy(&out, &current, sizeof(out));
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (sequence == before) return;
+      }
+      readRetries++;
+      if (++spins >= SPIN_LIMIT) {
+        spins = 0;
+        vTaskDelay(1);
+      }
+    }
+  }
+
+  // Statistics
+  uint32_t getPublishes() const { return publishes; }
+  uint32_t getReadRetries() const { return readRetries; }
+};
+
+// Global instance
+extern SystemState systemState;
+
+#endif // SYSTEM_STATE_H
@@ -15,6 +15,25 @@ private:
   bool inFreezingDuration;  // True when maintaining freeze after reaching setpoint
   unsigned long coolingStoppedTime;   // Time when cooling was turned off
   
+  // Run-time statistics (/metrics)
+  uint32_t transitions;              // Peltier on/off switches
+  uint64_t coolingMsTotal;           // Completed on-periods
+  unsigned long coolingStartedTime;  // Start of the current on-period
+  
+  // Switch the Peltier, counting transitions and on-time
+  void setCooling(bool on) {
+    if (on != coolingActive) {
+      transitions++;
+      if (on) {
+        coolingStartedTime = millis();
+      } else {
+        coolingMsTotal += millis() - coolingStartedTime;
+      }
+    }
+    coolingActive = on;
+    digitalWrite(controlPin, on ? HIGH : LOW);
+  }
+  
 public:
   // Constructor
   Thermostat(int pin = PIN_PELTIER) 
@@ -25,7 +44,10 @@ public:
       coolingActive(false),
       setpointReachedTime(0),
       inFreezingDuration(false),
-      coolingStoppedTime(0) {
+      coolingStoppedTime(0),
+      transitions(0),
+      coolingMsTotal(0),
+      coolingStartedTime(0) {
   }
   
   // Initialize the thermostat hardware
@@ -74,10 +96,9 @@ public:
           // Check if freeze duration has elapsed
           if (millis() - setpointReachedTime >= DURATION_GLACIER_FREEZING) {
             // Duration complete - turn off cooling
-            coolingActive = false;
+            setCooling(false);
             inFreezingDuration = false;
             coolingStoppedTime = millis();  // Record when cooling stopped
-            digitalWrite(controlPin, LOW);
           }
           // Otherwise keep cooling
         }
@@ -92,9 +113,8 @@ public:
       // 2. Timer has elapsed since cooling stopped
       if (currentTemp >= reactivateTemp || 
           (millis() - coolingStoppedTime >= REACTIVATE_TIMER)) {
-        coolingActive = true;
+        setCooling(true);
         inFreezingDuration = false;
-        digitalWrite(controlPin, HIGH);
       }
     }
   }
@@ -102,21 +122,28 @@ public:
   // Force cooling to start immediately (called when drop detected)
   void forceActivate() {
     if (!coolingActive) {
-      coolingActive = true;
+      setCooling(true);
       inFreezingDuration = false;
-      digitalWrite(controlPin, HIGH);
     }
   }
   
   // Manual control (for testing)
   void turnOn() {
-    coolingActive = true;
-    digitalWrite(controlPin, HIGH);
+    setCooling(true);
   }
   
   void turnOff() {
-    coolingActive = false;
-    digitalWrite(controlPin, LOW);
+    setCooling(false);
+  }
+  
+  // Total Peltier on-time in milliseconds (including the current on-period)
+  uint64_t getCoolingMs() {
+    return coolingMsTotal + (coolingActive ? millis() - coolingStartedTime : 0);
+  }
+  
+  // Number of Peltier on/off switches
+  uint32_t getTransitions() {
+    return transitions;
   }
    
   // Set/get reactivate temperature
@@ -0,0 +1,4 @@
+#include "WeatherCache.h"
+
+// Global instance
+WeatherCache weatherCache;
@@ -0,0 +1,136 @@
+#ifndef WEATHER_CACHE_H
+#define WEATHER_CACHE_H
+
+#include <Preferences.h>
+#include <math.h>
+#include <time.h>
+#include "config.h"
+#include "WeatherStation.h"
+
+// Persists the last good weather readings to flash (ESP32 NVS)
+// Loaded at boot before WiFi comes up, so the station table starts from the
+// last real readings instead of the presets in WeatherStationData.h.
+// The hourly forecast is persisted too, so interpolation keeps working
+// after a reboot during a network outage.
+// All stations are stored as a single blob - one flash write per fetch.
+class WeatherCache {
+private:
+  Preferences preferences;
+  const char* NAMESPACE = "weather";
+  const char* READINGS_KEY = "readings2";  // Bumped when Entry layout changes
+
+  // One persisted reading (matched back to a station by coordinates)
+  struct Entry {
+    float lat;
+    float lon;
+    float temperature;
+    float humidity;
+    float dewPoint;
+    uint32_t epoch;   // Unix time of the reading (0 = unknown)
+    uint8_t valid;    // Station had been fetched at least once
+    WeatherForecast forecast;  // Keeps the setpoint moving through outages
+  };
+
+  static bool sameLocation(const Entry& e, const WeatherStation& s) {
+    return fabsf(e.lat - s.lat) < 0.001f && fabsf(e.lon - s.lon) < 0.001f;
+  }
+
+public:
+  // Wall clock is valid once NTP has synced (time() starts at 1970)
+  static bool clockValid() {
+    return time(nullptr) > 1700000000;
+  }
+
+  // Current Unix time, or 0 if the clock is not synced yet
+  static uint32_t nowEpoch() {
+    return clockValid() ? (uint32_t)time(nullptr) : 0;
+  }
+
+  // Age of a station reading in seconds (-1 = unknown)
+  static long ageSeconds(const WeatherStation& station) {
+    if (station.updatedAt != 0) {
+      return (millis() - station.updatedAt) / 1000;
+    }
+    if (station.fetchedEpoch != 0 && clockValid()) {
+      return (long)(nowEpoch() - station.fetchedEpoch);
+    }
+    return -1;
+  }
+
+  // Stale = the hourly forecast no longer covers now (nothing left to
+  // interpolate from) and the reading is older than WEATHER_STALE_AGE or of
+  // unknown age
+  static bool isStale(const WeatherStation& station) {
+    uint32_t now = nowEpoch();
+    float temperature;
+    if (now != 0 && forecastTemperature(station, now, temperature)) return false;
+    long age = ageSeconds(station);
+    return age < 0 || age > (long)(WEATHER_STALE_AGE / 1000);
+  }
+
+  // Restore persisted readings into the station table
+  // Returns the number of stations restored
+  int load(WeatherStation* stations, int numStations) {
+    Entry entries[WEATHER_MAX_STATIONS];
+
+    if (!preferences.begin(NAMESPACE, true)) {  // Read-only mode
+      return 0;
+    }
+    size_t bytes = preferences.getBytes(READINGS_KEY, entries, sizeof(entries));
+    preferences.end();
+
+    int count = bytes / sizeof(Entry);
+    int restored = 0;
+
+    for (int i = 0; i < numStations; i++) {
+      for (int j = 0; j < count; j++) {
+        if (entries[j].valid && sameLocation(entries[j], stations[i])) {
+          stations[i].temperature = entries[j].temperature;
+          stations[i].humidity = entries[j].humidity;
+          stations[i].dewPoint = entries[j].dewPoint;
+          stations[i].fetchedEpoch = entries[j].epoch;
+          stations[i].forecast = entries[j].forecast;
+          stations[i].updatedAt = 0;  // Not fetched this boot
+          restored++;
+          break;
+        }
+      }
+    }
+
+    Serial.printf("Weather cache: restored %d/%d stations\n", restored, numStations);
+    return restored;
+  }
+
+  // Persist the current readings of all stations
+  void save(const WeatherStation* stations, int numStations) {
+    Entry entries[WEATHER_MAX_STATIONS];
+    int count = min(numStations, WEATHER_MAX_STATIONS);
+
+    for (int i = 0; i < count; i++) {
+      entries[i].lat = stations[i].lat;
+      entries[i].lon = stations[i].lon;
+      entries[i].temperature = stations[i].temperature;
+      entries[i].humidity = stations[i].humidity;
+      entries[i].dewPoint = stations[i].dewPoint;
+      entries[i].epoch = stations[i].fetchedEpoch;
+      entries[i].valid = (stations[i].updatedAt != 0 || stations[i].fetchedEpoch != 0);
+      entries[i].forecast = stations[i].forecast;
+    }
+
+    preferences.begin(NAMESPACE, false);
+    preferences.putBytes(READINGS_KEY, entries, count * sizeof(Entry));
+    preferences.end();
+  }
+
+  // Erase persisted readings
+  void clear() {
+    preferences.begin(NAMESPACE, false);
+    preferences.clear();
+    preferences.end();
+  }
+};
+
+// Global instance
+extern WeatherCache weatherCache;
+
+#endif // WEATHER_CACHE_H
@@ -1,15 +1,50 @@
 #ifndef WEATHER_STATION_H
 #define WEATHER_STATION_H
 
+#include <stdint.h>
+#include "config.h"
+
+// Hourly temperature forecast (compact: tenths of °C, one value per hour)
+struct WeatherForecast {
+  uint32_t startEpoch;   // Unix time of the first hourly value (0 = no forecast)
+  uint8_t hours;         // Number of valid values
+  int16_t tenths[WEATHER_FORECAST_HOURS];
+};
+
 // Weather station structure
 struct WeatherStation {
-  const char* name;
+  char name[WEATHER_STATION_NAME_LEN];
   float lat;
   float lon;
-  const char* timezone;
+  char timezone[WEATHER_STATION_TZ_LEN];
   float temperature;
   float humidity;
   float dewPoint;
+  unsigned long updatedAt;  // millis() of the last fetch this boot (0 = not fetched yet)
+  uint32_t fetchedEpoch;    // Unix time of the reading (0 = unknown / preset value)
+  WeatherForecast forecast;
+  uint32_t fetchInterval;   // milliseconds between fetches (0 = WEATHER_UPDATE_INTERVAL)
+  uint8_t priority;         // Higher is fetched first
+  bool displayed;           // Shown on the dashboard (and therefore fetched)
 };
 
+// Interpolate the forecast temperature at a Unix time
+// Returns false if the forecast does not cover that time.
+inline bool forecastTemperature(const WeatherStation& station, uint32_t epoch, float& temperature) {
+  const WeatherForecast& f = station.forecast;
+  if (f.startEpoch == 0 || f.hours < 2 || epoch < f.startEpoch) {
+    return false;
+  }
+  uint32_t offset = epoch - f.startEpoch;
+  uint32_t index = offset / 3600;
+  if (index + 1 >= f.hours) {
+    return false;
+  }
+  float fraction = (offset % 3600) / 3600.0f;
+  float a = f.tenths[index];
+  float b = f.tenths[index + 1];
+  temperature = (a + (b - a) * fraction) / 10.0f;
+  return true;
+}
+
 #endif // WEATHER_STATION_H
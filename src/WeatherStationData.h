@@ -4,21 +4,34 @@
 #include "WeatherStation.h"
 
 // ============================================
-// WEATHER STATIONS CONFIGURATION
+// DEFAULT WEATHER STATIONS
 // ============================================
-// Edit this file to add/remove weather stations
-// NUM_STATIONS is automatically calculated from the array size
+// Factory defaults for the station registry (used on first boot and after
+// a station reset). Stations can be added/edited at runtime through the
+// web API (/api/stations) - those edits are persisted in flash.
 
-WeatherStation stations[] = {
-  {"Ilulissat", 69.2198, -51.0986, "America/Godthab", -2.0, 50.0, 0.0},                    // Greenland glacier
-  {"El Calafate", -50.3375, -72.2647, "America/Argentina/Rio_Gallegos", -2.0, 50.0, 0.0},  // Patagonia glacier
-  {"Hong Kong", 22.3193, 114.1694, "Asia/Hong_Kong", 26.0, 75.0, 0.0},                     // Humid reference
-  {"Shenzhen", 22.5431, 114.0579, "Asia/Shanghai", 14.0, 75.0, 0.0}                        // Local station
-}; 
+struct StationDefault {
+  const char* name;
+  float lat;
+  float lon;
+  const char* timezone;
+  float temperature;   // Preset until the first fetch
+  float humidity;
+  float dewPoint;
+  uint8_t priority;
+  bool displayed;
+};
 
-int NUM_STATIONS = sizeof(stations) / sizeof(stations[0]);  // Automatically calculated
+const StationDefault defaultStations[] = {
+  {"Ilulissat", 69.2198, -51.0986, "America/Godthab", -2.0, 50.0, 0.0, 2, true},                    // Greenland glacier
+  {"El Calafate", -50.3375, -72.2647, "America/Argentina/Rio_Gallegos", -2.0, 50.0, 0.0, 2, true},  // Patagonia glacier
+  {"Hong Kong", 22.3193, 114.1694, "Asia/Hong_Kong", 26.0, 75.0, 0.0, 1, true},                     // Humid reference
+  {"Shenzhen", 22.5431, 114.0579, "Asia/Shanghai", 14.0, 75.0, 0.0, 3, true}                        // Local station
+};
 
-// Station indices for easy reference
+const int NUM_DEFAULT_STATIONS = sizeof(defaultStations) / sizeof(defaultStations[0]);  // Automatically calculated
+
+// Station indices for easy reference (in the default table)
 const int GLACIER_ILULISSAT = 0;
 const int GLACIER_CALAFATE = 1;
 const int HUMID_HONGKONG = 2;
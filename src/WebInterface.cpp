@@ -1,837 +1,1103 @@
 #include "WebInterface.h"
 #include "WeatherStation.h"
 #include "WiFiManager.h"
-#include "Thermostat.h"
-#include "TemperatureSensor.h"
-#include "NeoPixelController.h"
-#include "AudioPlayer.h"
+#include "LatencyProbe.h"
+#include "WeatherCache.h"
+#include "StationRegistry.h"
+#include "DashboardHtml.h"
+#include "JsonArena.h"
+#include "CommandQueue.h"
+#include "SystemState.h"
+#include "HistoryLog.h"
+#include "MetricsWriter.h"
+#include "OtaUpdater.h"
 #include "SettingsManager.h"
+#include "AllocCounter.h"
 #include <ArduinoJson.h>
+#include <memory>
 
 // Global instance
 WebInterface webInterface;
 
 // External references to system components
-extern Thermostat thermostat;
-extern TemperatureSensor tempSensor;
-extern float cachedPeltierTemperature;
-extern int dropCount;
-extern WeatherStation stations[];
-extern SettingsManager settingsManager;
-extern int NUM_STATIONS;  // Calculated from stations array size
-extern int setpointMode;
-extern float manualSetpoint;
 extern WiFiManager wifiManager;
-extern NeoPixelController neoPixels;
-extern AudioPlayer audioPlayer;
-
-// Hardware status
-extern bool hwStatusTempSensor;
-extern bool hwStatusDropDetector;
-extern bool hwStatusNeoPixel;
-extern bool hwStatusAudioPlayer;
-extern bool hwStatusWiFi;
-extern bool hwStatusWebServer;
-
-// System control
-extern bool systemRunning;
-
-// Generate main HTML page
-String WebInterface::getHTML() {
-  return R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-  <meta charset="UTF-8">
-  <meta name="viewport" content="width=device-width, initial-scale=1.0">
-  <title>Dripping Meteorite</title>
-  <style>
-    body {
-      font-family: Arial, sans-serif;
-      max-width: 800px;
-      margin: 20px auto;
-      padding: 20px;
-      background: #1a1a1a;
-      color: #e0e0e0;
-    }
-    h1 {
-      color: #4a9eff;
-      text-align: center;
-      border-bottom: 2px solid #4a9eff;
-      padding-bottom: 10px;
-    }
-    .card {
-      background: #2a2a2a;
-      border-radius: 8px;
-      padding: 20px;
-      margin: 20px 0;
-      box-shadow: 0 4px 6px rgba(0,0,0,0.3);
-    }
-    .status-grid {
-      display: grid;
-      grid-template-columns: repeat(auto-fit, minmax(200px, 1fr));
-      gap: 15px;
-      margin: 20px 0;
-    }
-    .status-item {
-      background: #333;
-      padding: 15px;
-      border-radius: 6px;
-      border-left: 4px solid #4a9eff;
-    }
-    .status-label {
-      color: #999;
-      font-size: 0.9em;
-      margin-bottom: 5px;
-    }
-    .status-value {
-      font-size: 1.5em;
-      font-weight: bold;
-      color: #4a9eff;
-    }
-    .control-group {
-      margin: 15px 0;
-    }
-    label {
-      display: block;
-      margin-bottom: 5px;
-      color: #bbb;
-    }
-    input[type="number"], input[type="text"] {
-      width: 100%;
-      padding: 10px;
-      background: #333;
-      border: 1px solid #555;
-      border-radius: 4px;
-      color: #e0e0e0;
-      font-size: 1em;
-    }
-    select {
-      width: 100%;
-      padding: 10px;
-      background: #333;
-      border: 1px solid #555;
-      border-radius: 4px;
-      color: #e0e0e0;
-      font-size: 1em;
-    }
-    button {
-      background: #4a9eff;
-      color: white;
-      border: none;
-      padding: 12px 24px;
-      border-radius: 4px;
-      cursor: pointer;
-      font-size: 1em;
-      margin: 5px;
-    }
-    button:hover {
-      background: #3a8edf;
-    }
-    button:active {
-      background: #2a7ecf;
-    }
-    .weather-grid {
-      display: grid;
-      grid-template-columns: repeat(auto-fit, minmax(180px, 1fr));
-      gap: 10px;
-    }
-    .weather-item {
-      background: #333;
-      padding: 10px;
-      border-radius: 4px;
-      text-align: center;
-    }
-    .weather-name {
-      font-weight: bold;
-      color: #4a9eff;
-      margin-bottom: 5px;
-    }
-    .on { color: #4eff4a; }
-    .off { color: #ff4a4a; }
-    .hw-status {
-      display: grid;
-      grid-template-columns: repeat(auto-fit, minmax(150px, 1fr));
-      gap: 10px;
-    }
-    .hw-item {
-      background: #333;
-      padding: 10px;
-      border-radius: 4px;
-      display: flex;
-      justify-content: space-between;
-      align-items: center;
+
+// Serve the dashboard - gzip from flash (web/index.html, embedded at build time)
+// Sent straight from PROGMEM without a heap copy. Browsers keep the page but
+// revalidate it on every load (no-cache): If-None-Match gets an empty 304
+// until new firmware brings a new page and ETag.
+void WebInterface::handleRoot(AsyncWebServerRequest *request) {
+  if (request->hasHeader("If-None-Match") &&
+      request->getHeader("If-None-Match")->value() == DASHBOARD_ETAG) {
+    AsyncWebServerResponse *response = request->beginResponse(304);
+    response->addHeader("ETag", DASHBOARD_ETAG);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+    return;
+  }
+  
+  AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html",
+                                                              DASHBOARD_HTML_GZ, DASHBOARD_HTML_GZ_LEN);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", DASHBOARD_ETAG);
+  response->addHeader("Cache-Control", "no-cache");  // Revalidate every load - a firmware update shows at once
+  request->send(response);
+}
+
+// Status response memory (async TCP task only - see handleStatus)
+alignas(max_align_t) static uint8_t statusArenaPool[STATUS_ARENA_SIZE];
+static JsonArena statusArena(statusArenaPool, sizeof(statusArenaPool));
+static WebInterface::StatusBuffer statusBuffers[STATUS_BUFFER_SLOTS];
+static SystemState::Snapshot statusState;  // Copy taken by buildStatus()
+
+// Snapshot for the SSE pushes (loop() only)
+static SystemState::Snapshot pushState;
+
+// Metrics response memory (async TCP task only - see handleMetrics)
+static char metricsBuffer[METRICS_BUFFER_SIZE];
+static volatile bool metricsBusy = false;
+static SystemState::Snapshot metricsState;
+
+// Station list memory (async TCP task only - see handleStations)
+static WeatherStation stationsCopy[WEATHER_MAX_STATIONS];
+static SystemState::Snapshot stationsState;
+
+// Dotted-quad into a 16-byte buffer
+static void formatIP(char (&out)[16], const IPAddress& ip) {
+  snprintf(out, sizeof(out), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+}
+
+// Heap check: a steady-state /api/status request must not allocate
+// handleStatus counts the allocator calls of the async TCP task from its
+// first statement until the response is handed to the server (AllocCounter;
+// the response object itself belongs to ESPAsyncWebServer). After
+// STATUS_HEAP_WARMUP requests (first-use allocations) the next
+// STATUS_HEAP_CHECK_REQUESTS requests must make exactly zero allocations and
+// zero arena fallbacks. Allocate-then-free counts as well - that is what
+// fragments the heap. The verdict is reported in statusWriter.heapCheck and
+// logged once.
+void WebInterface::recordStatusHeap(uint32_t allocations, uint32_t fallbacksBefore) {
+  HeapCheck& check = statusStats.heap;
+  if (check.state == HEAP_WARMUP) {
+    if (statusStats.requests > STATUS_HEAP_WARMUP) check.state = HEAP_MEASURING;
+    return;
+  }
+  if (check.state != HEAP_MEASURING) return;
+  
+  check.allocations += allocations;
+  if (allocations > 0) check.allocatingRequests++;
+  check.fallbacks += statusArena.getHeapFallbacks() - fallbacksBefore;
+  if (++check.measured < STATUS_HEAP_CHECK_REQUESTS) return;
+  
+  bool wrapped = AllocCounter::isWrapped();
+  bool pass = wrapped && check.allocations == 0 && check.fallbacks == 0;
+  check.state = pass ? HEAP_PASS : HEAP_FAIL;
+  Serial.printf("Status heap check %s: %lu requests, %lu allocations in %lu of them, %lu arena fallbacks%s\n",
+                pass ? "passed" : "FAILED", (unsigned long)check.measured, (unsigned long)check.allocations,
+                (unsigned long)check.allocatingRequests, (unsigned long)check.fallbacks,
+                wrapped ? "" : " (allocator not wrapped - check the -Wl,--wrap build flags)");
+}
+
+// Reserve a free response buffer (nullptr if all are still being sent)
+WebInterface::StatusBuffer* WebInterface::acquireStatusBuffer() {
+  for (int i = 0; i < STATUS_BUFFER_SLOTS; i++) {
+    if (!statusBuffers[i].busy) {
+      statusBuffers[i].busy = true;
+      return &statusBuffers[i];
     }
-    .hw-ok { color: #4eff4a; font-weight: bold; }
-    .hw-fail { color: #ff4a4a; font-weight: bold; }
-    .hw-warn { color: #ffaa4a; font-weight: bold; }
-  </style>
-</head>
-<body>
-  <h1>❄️ Melting Glaciers Clock ❄️</h1>
-  
-  <div class="card" style="background: #2c3e50;">
-    <h2 style="margin-bottom: 10px;">System Control</h2>
-    <button id="system-toggle-btn" onclick="toggleSystem()" style="font-size: 1.2em; padding: 15px 30px;">SYSTEM: RUNNING</button>
-    <p style="font-size: 0.9em; color: #bbb; margin-top: 10px;">Pause/resume thermostat and sensor updates</p>
-  </div>
-  
-  <div class="card">
-    <h2>Hardware Status</h2>
-    <div class="hw-status">
-      <div class="hw-item">
-        <span>Temperature Sensor</span>
-        <span id="hw-temp" class="hw-ok">OK</span>
-      </div>
-      <div class="hw-item">
-        <span>Drop Detector</span>
-        <span id="hw-drop" class="hw-ok">OK</span>
-      </div>
-      <div class="hw-item">
-        <span>NeoPixels</span>
-        <span id="hw-neo" class="hw-ok">OK</span>
-      </div>
-      <div class="hw-item">
-        <span>Audio Player</span>
-        <span id="hw-audio" class="hw-ok">OK</span>
-      </div>
-      <div class="hw-item">
-        <span>WiFi Station</span>
-        <span id="hw-wifi" class="hw-warn">N/A</span>
-      </div>
-      <div class="hw-item">
-        <span>Web Server</span>
-        <span id="hw-web" class="hw-ok">OK</span>
-      </div>
-    </div>
-  </div>
-  
-  <div class="card">
-    <h2>System Status</h2>
-    <div class="status-grid">
-      <div class="status-item">
-        <div class="status-label">Thermostat</div>
-        <div class="status-value" id="thermostat-state">--</div>
-      </div>
-      <div class="status-item">
-        <div class="status-label">Peltier Temp</div>
-        <div class="status-value" id="peltier-temp">--°C</div>
-      </div>
-      <div class="status-item">
-        <div class="status-label">Setpoint</div>
-        <div class="status-value" id="setpoint">--°C</div>
-      </div>
-      <div class="status-item">
-        <div class="status-label">Drop Count</div>
-        <div class="status-value" id="drop-count">--</div>
-      </div>
-    </div>
-  </div>
-  
-  <div class="card">
-    <h2>Weather Stations</h2>
-    <div class="weather-grid" id="weather-grid">
-      <!-- Populated by JavaScript -->
-    </div>
-  </div>
-  
-  <div class="card">
-    <h2>Control Parameters</h2>
-    <div class="control-group">
-      <label>Setpoint Mode</label>
-      <select id="setpoint-mode" onchange="toggleSetpointMode()">
-        <option value="-1">Manual</option>
-        <option value="0">Link to Ilulissat</option>
-        <option value="1">Link to El Calafate</option>
-        <option value="2">Link to Hong Kong</option>
-        <option value="3">Link to Shenzhen</option>
-      </select>
-    </div>
-    <div class="control-group" id="manual-setpoint-group">
-      <label>Manual Setpoint (°C)</label>
-      <input type="number" step="0.5" id="manual-setpoint" value="-3.0">
-    </div>
-    <div class="control-group">
-      <label>Reactivate Temperature (°C)</label>
-      <input type="number" step="0.5" id="reactivate-temp" value="20.0">
-    </div>
-    <div class="control-group">
-      <label>Freezing Duration (seconds)</label>
-      <input type="number" step="1" id="freeze-duration" value="10">
-    </div>
-    <div class="control-group">
-      <label>Reactivate Timer (minutes)</label>
-      <input type="number" step="1" id="reactivate-timer" value="30">
-    </div>
-    <div class="control-group">
-      <label>LED Fade Time (seconds)</label>
-      <input type="number" step="0.1" id="led-fade-time" value="4">
-    </div>
-    <div class="control-group">
-      <label>LED Brightness (0-255)</label>
-      <input type="number" min="0" max="255" id="led-brightness" value="255">
-    </div>
-    <div class="control-group">
-      <label>Cube Light (Ambient Glow)</label>
-      <select id="cube-light">
-        <option value="1">ON</option>
-        <option value="0">OFF</option>
-      </select>
-    </div>
-    <div>
-      <label>Cube Light Brightness (0-255)</label>
-      <input type="number" id="cube-brightness" min="0" max="255" step="1">
-    </div>
-    <button onclick="updateParameters()">Update Parameters</button>
-    <button onclick="triggerDrop()">Test Drop</button>
-  </div>
-  
-  <div class="card">
-    <h2>Manual Tests</h2>
-    <button id="peltier-toggle-btn" onclick="togglePeltier()">Peltier: OFF</button>
-    <button onclick="testLED()">Test LED (5sec)</button>
-    <button onclick="testAudio()">Test Audio</button>
-  </div>
-  
-  <div class="card">
-    <h2>Settings</h2>
-    <button onclick="resetToDefaults()" style="background-color: #d9534f;">Reset to Defaults</button>
-    <p style="font-size: 0.9em; color: #666;">Restores all settings from config.h</p>
-  </div>
-  
-  <div class="card">
-    <h2>Network</h2>
-    <div id="network-info">Loading...</div>
-  </div>
-  
-  <script>
-    // Track if user is editing any input field
-    let userIsEditing = false;
-    let editTimeout = null;
-    
-    // Pause auto-refresh when user focuses on input fields
-    document.addEventListener('focusin', (e) => {
-      if (e.target.tagName === 'INPUT' || e.target.tagName === 'SELECT') {
-        userIsEditing = true;
-        clearTimeout(editTimeout);
-      }
-    });
-    
-    // Resume auto-refresh 3 seconds after user stops editing
-    document.addEventListener('focusout', (e) => {
-      if (e.target.tagName === 'INPUT' || e.target.tagName === 'SELECT') {
-        clearTimeout(editTimeout);
-        editTimeout = setTimeout(() => {
-          userIsEditing = false;
-        }, 3000);
+  }
+  return nullptr;
+}
+
+// Send length bytes straight from the buffer (no copy) and release it once
+// the connection is closed
+void WebInterface::sendStatusBuffer(AsyncWebServerRequest *request, StatusBuffer* buffer,
+                                    size_t length, const char* contentType) {
+  AsyncWebServerResponse *response = request->beginResponse_P(200, contentType,
+                                                              (const uint8_t*)buffer->data, length);
+  response->addHeader("Vary", "Accept");  // JSON or MessagePack by Accept header
+  request->onDisconnect([buffer]() { buffer->busy = false; });
+  request->send(response);
+}
+
+// Post a command for loop() and answer with its reply once executed
+// The handler returns immediately; the chunked response is filled from the
+// async TCP poll once the reply is ready, or after COMMAND_REPLY_TIMEOUT with
+// the reply ID (the client can fetch the result from /api/command?id=).
+void WebInterface::postCommand(AsyncWebServerRequest *request, CommandQueue::Command& cmd) {
+  uint32_t id = commandQueue.post(cmd);
+  if (id == 0) {
+    request->send(503, "application/json", "{\"status\":\"error\",\"message\":\"Busy, retry\"}");
+    return;
+  }
+  
+  unsigned long postedAt = millis();
+  AsyncWebServerResponse *response = request->beginChunkedResponse("application/json",
+    [id, postedAt](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+      if (index > 0) return 0;  // Reply went out in the first chunk
+      size_t length = 0;
+      CommandQueue::ReplyState state = commandQueue.getReply(id, (char*)buffer, maxLen, length);
+      if (state == CommandQueue::REPLY_READY) {
+        return length;
       }
-    });
-    
-    // Also pause when user types
-    document.addEventListener('input', (e) => {
-      if (e.target.tagName === 'INPUT') {
-        userIsEditing = true;
-        clearTimeout(editTimeout);
-        editTimeout = setTimeout(() => {
-          userIsEditing = false;
-        }, 3000);
+      if (state == CommandQueue::REPLY_PENDING && millis() - postedAt < COMMAND_REPLY_TIMEOUT) {
+        return RESPONSE_TRY_AGAIN;
       }
+      int n = snprintf((char*)buffer, maxLen, "{\"status\":\"pending\",\"id\":%lu}", (unsigned long)id);
+      return (n > 0 && (size_t)n < maxLen) ? n : 0;
     });
-    
-    // Fetch and update status every 2 seconds
-    function updateStatus() {
-      // Skip update if user is editing
-      if (userIsEditing) {
-        return;
-      }
-      
-      fetch('/api/status')
-        .then(response => response.json())
-        .then(data => {
-          // Update hardware status
-          updateHWStatus('hw-temp', data.hardware.tempSensor);
-          updateHWStatus('hw-drop', data.hardware.dropDetector);
-          updateHWStatus('hw-neo', data.hardware.neoPixel);
-          updateHWStatus('hw-audio', data.hardware.audioPlayer);
-          updateHWStatus('hw-wifi', data.hardware.wifi);
-          updateHWStatus('hw-web', data.hardware.webServer);
-          
-          // Update system status
-          document.getElementById('thermostat-state').innerHTML = 
-            data.thermostat.cooling ? '<span class="on">COOLING</span>' : '<span class="off">OFF</span>';
-          document.getElementById('peltier-temp').textContent = data.peltierTemp.toFixed(1) + '°C';
-          document.getElementById('setpoint').textContent = data.thermostat.setpoint.toFixed(1) + '°C';
-          document.getElementById('drop-count').textContent = data.dropCount;
-          
-          // Update setpoint mode controls (only if not currently being edited)
-          const setpointModeEl = document.getElementById('setpoint-mode');
-          const manualSetpointEl = document.getElementById('manual-setpoint');
-          if (document.activeElement !== setpointModeEl) {
-            setpointModeEl.value = data.setpointMode;
-          }
-          if (document.activeElement !== manualSetpointEl) {
-            manualSetpointEl.value = data.manualSetpoint.toFixed(1);
-          }
-          toggleSetpointMode();  // Show/hide manual setpoint field
-          
-          // Update settings fields (only if not being edited)
-          const freezeDurationEl = document.getElementById('freeze-duration');
-          const reactivateTimerEl = document.getElementById('reactivate-timer');
-          const ledFadeTimeEl = document.getElementById('led-fade-time');
-          const ledBrightnessEl = document.getElementById('led-brightness');
-          const reactivateTempEl = document.getElementById('reactivate-temp');
-          const cubeLightEl = document.getElementById('cube-light');
-          const cubeBrightnessEl = document.getElementById('cube-brightness');
-          
-          if (document.activeElement !== freezeDurationEl) {
-            freezeDurationEl.value = data.settings.freezeDurationSec.toFixed(0);
-          }
-          if (document.activeElement !== reactivateTimerEl) {
-            reactivateTimerEl.value = data.settings.reactivateTimerMin.toFixed(0);
-          }
-          if (document.activeElement !== ledFadeTimeEl) {
-            ledFadeTimeEl.value = data.settings.ledFadeTimeSec.toFixed(1);
-          }
-          if (document.activeElement !== ledBrightnessEl) {
-            ledBrightnessEl.value = data.settings.ledBrightness;
-          }
-          if (document.activeElement !== reactivateTempEl) {
-            reactivateTempEl.value = data.thermostat.reactivateTemp.toFixed(1);
-          }
-          if (document.activeElement !== cubeLightEl) {
-            cubeLightEl.value = data.settings.cubeLight ? '1' : '0';
-          }
-          if (document.activeElement !== cubeBrightnessEl) {
-            cubeBrightnessEl.value = data.settings.cubeLightBrightness;
-          }
-          
-          // Update Peltier button state
-          const peltierBtn = document.getElementById('peltier-toggle-btn');
-          peltierBtn.textContent = data.thermostat.cooling ? 'Peltier: ON (Force OFF)' : 'Peltier: OFF (Force ON)';
-          peltierBtn.style.backgroundColor = data.thermostat.cooling ? '#5cb85c' : '#d9534f';
-          
-          // Update weather stations
-          let weatherHTML = '';
-          data.weather.forEach(station => {
-            weatherHTML += `
-              <div class="weather-item">
-                <div class="weather-name">${station.name}</div>
-                <div>${station.temp.toFixed(1)}°C</div>
-                <div>${station.humidity.toFixed(0)}%</div>
-              </div>
-            `;
-          });
-          document.getElementById('weather-grid').innerHTML = weatherHTML;
-          
-          // Update network info
-          document.getElementById('network-info').innerHTML = 
-            `<strong>AP:</strong> ${data.network.apSSID} @ ${data.network.apIP}<br>` +
-            (data.network.stationConnected ? 
-              `<strong>WiFi:</strong> ${data.network.stationIP}` : 
-              `<strong>WiFi:</strong> Not connected`);
-        })
-        .catch(err => console.error('Status update failed:', err));
-    }
-    
-    function updateHWStatus(elementId, status) {
-      const elem = document.getElementById(elementId);
-      elem.className = status ? 'hw-ok' : 'hw-fail';
-      elem.textContent = status ? 'OK' : 'FAIL';
-    }
-    
-    function toggleSetpointMode() {
-      const mode = parseInt(document.getElementById('setpoint-mode').value);
-      const manualGroup = document.getElementById('manual-setpoint-group');
-      // Show manual setpoint input only when in manual mode
-      manualGroup.style.display = (mode === -1) ? 'block' : 'none';
-    }
-    
-    function updateParameters() {
-      const params = new URLSearchParams();
-      params.append('setpointMode', document.getElementById('setpoint-mode').value);
-      params.append('manualSetpoint', document.getElementById('manual-setpoint').value);
-      params.append('reactivateTemp', document.getElementById('reactivate-temp').value);
-      // Convert to milliseconds
-      params.append('freezeDuration', document.getElementById('freeze-duration').value * 1000);  // seconds to ms
-      params.append('reactivateTimer', document.getElementById('reactivate-timer').value * 60000);  // minutes to ms
-      // Convert seconds to milliseconds
-      params.append('ledFadeTime', document.getElementById('led-fade-time').value * 1000);
-      params.append('ledBrightness', document.getElementById('led-brightness').value);
-      params.append('cubeLight', document.getElementById('cube-light').value);
-      params.append('cubeLightBrightness', document.getElementById('cube-brightness').value);
-      
-      fetch('/api/update', {
-        method: 'POST',
-        headers: {'Content-Type': 'application/x-www-form-urlencoded'},
-        body: params
-      })
-      .then(response => response.json())
-      .then(data => {
-        alert(data.message || 'Parameters updated!');
-        updateStatus();  // Refresh status immediately
-      })
-      .catch(err => alert('Update failed: ' + err));
-    }
-    
-    function triggerDrop() {
-      fetch('/api/drop', {method: 'POST'})
-        .then(response => response.json())
-        .then(data => updateStatus())
-        .catch(err => console.error('Failed to trigger drop:', err));
-    }
-    
-    function togglePeltier() {
-      fetch('/api/peltier/toggle', {method: 'POST'})
-        .then(response => response.json())
-        .then(data => {
-          console.log('Peltier toggled:', data.message);
-        })
-        .catch(err => console.error('Peltier toggle failed:', err));
-    }
-    
-    function toggleSystem() {
-      fetch('/api/system/toggle', {method: 'POST'})
-        .then(response => response.json())
-        .then(data => {
-          const btn = document.getElementById('system-toggle-btn');
-          btn.textContent = data.running ? 'SYSTEM: RUNNING' : 'SYSTEM: PAUSED';
-          btn.style.backgroundColor = data.running ? '#5cb85c' : '#d9534f';
-        })
-        .catch(err => console.error('System toggle failed:', err));
-    }
-    
-    function testLED() {
-      fetch('/api/test/led', {method: 'POST'})
-        .then(response => response.json())
-        .then(data => updateStatus())
-        .catch(err => console.error('LED test failed:', err));
-    }
-    
-    function testAudio() {
-      fetch('/api/test/audio', {method: 'POST'})
-        .then(response => response.json())
-        .then(data => updateStatus())
-        .catch(err => console.error('Audio test failed:', err));
-    }
-    
-    function resetToDefaults() {
-      if (confirm('Reset all settings to defaults from config.h? This will restart the device.')) {
-        fetch('/api/reset', { method: 'POST' })
-          .then(response => response.json())
-          .then(data => {
-            alert(data.message);
-            setTimeout(() => { location.reload(); }, 3000);
-          })
-          .catch(error => console.error('Error:', error));
+  request->send(response);
+}
+
+void WebInterface::postCommand(AsyncWebServerRequest *request, CommandQueue::CommandType type) {
+  CommandQueue::Command cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type = type;
+  postCommand(request, cmd);
+}
+
+// Handle command reply lookup (?id= from a pending response)
+void WebInterface::handleCommandReply(AsyncWebServerRequest *request) {
+  uint32_t id = request->hasParam("id") ? request->getParam("id")->value().toInt() : 0;
+  char body[COMMAND_REPLY_SIZE];
+  size_t length = 0;
+  
+  switch (commandQueue.getReply(id, body, sizeof(body), length)) {
+    case CommandQueue::REPLY_READY:
+      request->send(200, "application/json", body);
+      break;
+    case CommandQueue::REPLY_PENDING:
+      snprintf(body, sizeof(body), "{\"status\":\"pending\",\"id\":%lu}", (unsigned long)id);
+      request->send(202, "application/json", body);
+      break;
+    default:
+      request->send(404, "application/json", "{\"status\":\"error\",\"message\":\"Unknown command id\"}");
+      break;
+  }
+}
+
+// Push a compact status event when something changed
+// The message is formatted into a stack buffer - no JsonDocument, no String.
+void WebInterface::pushUpdates() {
+  if (events.count() == 0) {
+    hasLastPush = false;  // Next client gets a fresh push
+    return;
+  }
+  
+  if (refreshPending) {
+    refreshPending = false;
+    events.send("{}", "refresh", ++pushId);
+  }
+  
+  systemState.read(pushState);
+  PushState now;
+  now.cooling = pushState.cooling;
+  now.setpointTenths = lroundf(pushState.setpoint * 10.0f);
+  now.peltierTenths = lroundf(pushState.peltierTemp * 10.0f);
+  now.dropCount = pushState.dropCount;
+  now.systemRunning = pushState.systemRunning;
+  now.setpointMode = pushState.setpointMode;
+  now.wifi = pushState.hwWiFi;
+  
+  unsigned long elapsed = millis() - lastPushTime;
+  bool urgent = !hasLastPush ||
+                now.dropCount != lastPush.dropCount ||
+                now.cooling != lastPush.cooling ||
+                now.systemRunning != lastPush.systemRunning ||
+                now.setpointMode != lastPush.setpointMode ||
+                now.wifi != lastPush.wifi;
+  bool changed = urgent ||
+                 now.setpointTenths != lastPush.setpointTenths ||
+                 now.peltierTenths != lastPush.peltierTenths;
+  
+  if (!urgent && !(changed && elapsed >= SSE_MIN_INTERVAL) && elapsed < SSE_HEARTBEAT_INTERVAL) {
+    return;
+  }
+  
+  char message[160];
+  snprintf(message, sizeof(message),
+           "{\"cooling\":%s,\"setpoint\":%.1f,\"peltierTemp\":%.1f,\"dropCount\":%d,"
+           "\"systemRunning\":%s,\"setpointMode\":%d,\"wifi\":%s}",
+           now.cooling ? "true" : "false", now.setpointTenths / 10.0f, now.peltierTenths / 10.0f,
+           now.dropCount, now.systemRunning ? "true" : "false", now.setpointMode,
+           now.wifi ? "true" : "false");
+  events.send(message, "status", ++pushId);
+  
+  lastPush = now;
+  hasLastPush = true;
+  lastPushTime = millis();
+}
+
+// Names accepted by ?fields= (same as the top-level keys of the document)
+// part: version in the snapshot, -1 = not versioned (left out of deltas)
+static const struct {
+  const char* name;
+  uint32_t section;
+  int part;
+} statusSectionNames[] = {
+  {"thermostat",     WebInterface::SECTION_THERMOSTAT,      SystemState::PART_THERMOSTAT},
+  {"peltierTemp",    WebInterface::SECTION_PELTIER_TEMP,    SystemState::PART_PELTIER_TEMP},
+  {"dropCount",      WebInterface::SECTION_DROP_COUNT,      SystemState::PART_DROP_COUNT},
+  {"setpointMode",   WebInterface::SECTION_SETPOINT_MODE,   SystemState::PART_SETPOINT_MODE},
+  {"manualSetpoint", WebInterface::SECTION_MANUAL_SETPOINT, SystemState::PART_MANUAL_SETPOINT},
+  {"hardware",       WebInterface::SECTION_HARDWARE,        SystemState::PART_HARDWARE},
+  {"weather",        WebInterface::SECTION_WEATHER,         SystemState::PART_WEATHER},
+  {"network",        WebInterface::SECTION_NETWORK,         SystemState::PART_NETWORK},
+  {"weatherClient",  WebInterface::SECTION_WEATHER_CLIENT,  SystemState::PART_WEATHER_CLIENT},
+  {"settings",       WebInterface::SECTION_SETTINGS,        SystemState::PART_SETTINGS},
+  {"statusWriter",   WebInterface::SECTION_STATUS_WRITER,   -1},
+  {"history",        WebInterface::SECTION_HISTORY,         SystemState::PART_HISTORY},
+  {"stateSnapshot",  WebInterface::SECTION_STATE_SNAPSHOT,  -1},
+};
+
+// Parse a comma-separated field list into section bits
+// Returns false on an unknown name.
+bool WebInterface::parseStatusFields(const char* list, uint32_t& sections) {
+  sections = 0;
+  const char* p = list;
+  while (*p) {
+    const char* end = strchr(p, ',');
+    size_t len = end ? (size_t)(end - p) : strlen(p);
+    if (len > 0) {
+      bool known = false;
+      for (const auto& entry : statusSectionNames) {
+        if (strlen(entry.name) == len && strncmp(entry.name, p, len) == 0) {
+          sections |= entry.section;
+          known = true;
+          break;
+        }
       }
+      if (!known) return false;
     }
-    
-    // Start auto-refresh
-    updateStatus();
-    setInterval(updateStatus, 2000);
-  </script>
-</body>
-</html>
-)rawliteral";
+    p += len;
+    if (*p == ',') p++;
+  }
+  return true;
 }
 
-// Handle status API endpoint - return JSON with current system state
-void WebInterface::handleStatus(AsyncWebServerRequest *request) {
-  JsonDocument doc;
+// Fill the status document (shared by /api/status and its variants)
+// Control state comes from one consistent snapshot published by loop().
+// Only the requested sections are built; with since != 0 only the versioned
+// ones that changed after that version. Returns false if that left nothing.
+bool WebInterface::buildStatus(JsonDocument& doc, uint32_t sections, uint32_t since) {
+  systemState.read(statusState);
+  const SystemState::Snapshot& state = statusState;
+  
+  // A version from the future is from before a reboot - send everything
+  if (since != 0 && since <= state.version) {
+    uint32_t changed = 0;
+    for (const auto& entry : statusSectionNames) {
+      if (entry.part >= 0 && state.partVersion[entry.part] > since) changed |= entry.section;
+    }
+    sections &= changed;
+    if (sections == 0) return false;
+  }
+  doc["version"] = state.version;
   
   // Thermostat status
-  doc["thermostat"]["cooling"] = thermostat.isCooling();
-  doc["thermostat"]["setpoint"] = thermostat.getSetPoint();
-  doc["thermostat"]["reactivateTemp"] = thermostat.getReactivateTemp();
+  if (sections & SECTION_THERMOSTAT) {
+    doc["thermostat"]["cooling"] = state.cooling;
+    doc["thermostat"]["setpoint"] = state.setpoint;
+    doc["thermostat"]["reactivateTemp"] = state.reactivateTemp;
+  }
   
   // Temperature and drops
-  doc["peltierTemp"] = cachedPeltierTemperature;
-  doc["dropCount"] = dropCount;
+  if (sections & SECTION_PELTIER_TEMP) doc["peltierTemp"] = state.peltierTemp;
+  if (sections & SECTION_DROP_COUNT) doc["dropCount"] = state.dropCount;
   
   // Setpoint mode
-  doc["setpointMode"] = setpointMode;
-  doc["manualSetpoint"] = manualSetpoint;
+  if (sections & SECTION_SETPOINT_MODE) doc["setpointMode"] = state.setpointMode;
+  if (sections & SECTION_MANUAL_SETPOINT) doc["manualSetpoint"] = state.manualSetpoint;
   
   // Hardware status
-  doc["hardware"]["tempSensor"] = hwStatusTempSensor;
-  doc["hardware"]["dropDetector"] = hwStatusDropDetector;
-  doc["hardware"]["neoPixel"] = hwStatusNeoPixel;
-  doc["hardware"]["audioPlayer"] = hwStatusAudioPlayer;
-  doc["hardware"]["wifi"] = hwStatusWiFi;
-  doc["hardware"]["webServer"] = hwStatusWebServer;
+  if (sections & SECTION_HARDWARE) {
+    doc["hardware"]["tempSensor"] = state.hwTempSensor;
+    doc["hardware"]["dropDetector"] = state.hwDropDetector;
+    doc["hardware"]["neoPixel"] = state.hwNeoPixel;
+    doc["hardware"]["audioPlayer"] = state.hwAudioPlayer;
+    doc["hardware"]["wifi"] = state.hwWiFi;
+    doc["hardware"]["webServer"] = state.hwWebServer;
+  }
   
   // Weather stations
-  JsonArray weatherArray = doc["weather"].to<JsonArray>();
-  for (int i = 0; i < NUM_STATIONS; i++) {
-    JsonObject station = weatherArray.add<JsonObject>();
-    station["name"] = stations[i].name;
-    station["temp"] = stations[i].temperature;
-    station["humidity"] = stations[i].humidity;
+  if (sections & SECTION_WEATHER) {
+    JsonArray weatherArray = doc["weather"].to<JsonArray>();
+    for (int i = 0; i < state.numStations; i++) {
+      const SystemState::StationView& s = state.stations[i];
+      JsonObject station = weatherArray.add<JsonObject>();
+      station["index"] = i;
+      station["name"] = s.name;
+      station["temp"] = s.temperature;
+      station["humidity"] = s.humidity;
+      station["ageSec"] = s.ageSec;  // -1 = unknown
+      station["stale"] = s.stale;
+      station["referenced"] = s.referenced;  // Being fetched
+    }
+  }
+  
+  if (sections & SECTION_NETWORK) {
+    // Network info (addresses formatted on the stack - IPAddress::toString() allocates)
+    char apIPText[16];
+    char stationIPText[16];
+    formatIP(apIPText, apIP);
+    formatIP(stationIPText, WiFi.localIP());
+    doc["network"]["apSSID"] = apSSID.c_str();
+    doc["network"]["apIP"] = apIPText;
+    doc["network"]["stationConnected"] = (WiFi.status() == WL_CONNECTED);
+    doc["network"]["stationIP"] = stationIPText;
+    
+    // WiFi connection state machine
+    const WiFiManager::ConnStats& conn = wifiManager.getConnStats();
+    doc["network"]["wifiState"] = wifiManager.getStateName();
+    doc["network"]["connectAttempts"] = conn.attempts;
+    doc["network"]["connectFailures"] = conn.failures;
+    doc["network"]["disconnects"] = conn.disconnects;
+    doc["network"]["lastConnectMs"] = conn.lastConnectMs;
+    doc["network"]["avgConnectMs"] = conn.successes ? conn.totalConnectMs / conn.successes : 0;
   }
   
-  // Network info
-  doc["network"]["apSSID"] = apSSID;
-  doc["network"]["apIP"] = apIP.toString();
-  doc["network"]["stationConnected"] = (WiFi.status() == WL_CONNECTED);
-  doc["network"]["stationIP"] = WiFi.localIP().toString();
+  // Weather HTTP client (connection reuse, handshake cost, traffic)
+  if (sections & SECTION_WEATHER_CLIENT) {
+    const WiFiManager::HttpStats& http = wifiManager.getHttpStats();
+    doc["weatherClient"]["host"] = wifiManager.getWeatherHost();
+    doc["weatherClient"]["port"] = wifiManager.getWeatherPort();
+    doc["weatherClient"]["requests"] = http.requests;
+    doc["weatherClient"]["reusedRequests"] = http.reusedRequests;
+    doc["weatherClient"]["reuseRate"] = http.requests ? (float)http.reusedRequests / http.requests : 0.0;
+    doc["weatherClient"]["closedAfterResponse"] = http.closedAfterResponse;
+    doc["weatherClient"]["chunkedResponses"] = http.chunkedResponses;
+    doc["weatherClient"]["handshakes"] = http.handshakes;
+    doc["weatherClient"]["lastHandshakeMs"] = http.lastHandshakeMs;
+    doc["weatherClient"]["avgHandshakeMs"] = http.handshakes ? http.handshakeTimeMs / http.handshakes : 0;
+    doc["weatherClient"]["bytesReceived"] = http.bytesReceived;
+    doc["weatherClient"]["dnsLookups"] = http.dnsLookups;
+    doc["weatherClient"]["dnsCacheHits"] = http.dnsCacheHits;
+    doc["weatherClient"]["errors"] = http.errors;
+  }
   
   // Settings (with unit conversions for display)
-  doc["settings"]["freezeDurationSec"] = settingsManager.currentSettings.durationGlacierFreezing / 1000.0;  // ms to seconds
-  doc["settings"]["reactivateTimerMin"] = settingsManager.currentSettings.reactivateTimer / 60000.0;  // ms to minutes
-  doc["settings"]["ledFadeTimeSec"] = settingsManager.currentSettings.ledFadeTotalTime / 1000.0;  // ms to seconds
-  doc["settings"]["ledBrightness"] = settingsManager.currentSettings.neopixelBrightness;
-  doc["settings"]["cubeLight"] = settingsManager.currentSettings.cubeLight;
-  doc["settings"]["cubeLightBrightness"] = settingsManager.currentSettings.cubeLightBrightness;
+  if (sections & SECTION_SETTINGS) {
+    doc["settings"]["freezeDurationSec"] = state.freezeDuration / 1000.0;  // ms to seconds
+    doc["settings"]["reactivateTimerMin"] = state.reactivateTimer / 60000.0;  // ms to minutes
+    doc["settings"]["ledFadeTimeSec"] = state.ledFadeTime / 1000.0;  // ms to seconds
+    doc["settings"]["ledBrightness"] = state.ledBrightness;
+    doc["settings"]["cubeLight"] = state.cubeLight;
+    doc["settings"]["cubeLightBrightness"] = state.cubeLightBrightness;
+  }
   
-  String response;
-  serializeJson(doc, response);
-  request->send(200, "application/json", response);
+  // Status serializer (heapFallbacks/overflows should stay 0, heapCheck pass)
+  // json/msgpack: average response size and build + serialize time per format
+  if (sections & SECTION_STATUS_WRITER) {
+    doc["statusWriter"]["requests"] = statusStats.requests;
+    doc["statusWriter"]["arenaPeak"] = statusArena.getPeak();
+    doc["statusWriter"]["arenaSize"] = statusArena.getCapacity();
+    doc["statusWriter"]["heapFallbacks"] = statusArena.getHeapFallbacks();
+    doc["statusWriter"]["overflows"] = statusStats.overflows;
+    doc["statusWriter"]["busyRejects"] = statusStats.busyRejects;
+    doc["statusWriter"]["deltas"] = statusStats.deltas;
+    doc["statusWriter"]["notModified"] = statusStats.notModified;
+    const HeapCheck& heap = statusStats.heap;
+    static const char* heapStates[] = {"warmup", "measuring", "pass", "fail"};
+    doc["statusWriter"]["heapCheck"]["state"] = heapStates[heap.state];
+    doc["statusWriter"]["heapCheck"]["measured"] = heap.measured;
+    doc["statusWriter"]["heapCheck"]["allocations"] = heap.allocations;
+    doc["statusWriter"]["heapCheck"]["allocatingRequests"] = heap.allocatingRequests;
+    doc["statusWriter"]["heapCheck"]["fallbacks"] = heap.fallbacks;
+    const FormatStats* formats[] = {&statusStats.json, &statusStats.msgpack};
+    const char* formatNames[] = {"json", "msgpack"};
+    for (int i = 0; i < 2; i++) {
+      const FormatStats& f = *formats[i];
+      JsonObject format = doc["statusWriter"][formatNames[i]].to<JsonObject>();
+      format["responses"] = f.responses;
+      format["avgBytes"] = f.responses ? f.bytes / f.responses : 0;
+      format["avgUs"] = f.responses ? f.micros / f.responses : 0;
+    }
+  }
+  
+  // History log (LittleFS)
+  if (sections & SECTION_HISTORY) {
+    doc["history"]["mounted"] = historyLog.isMounted();
+    doc["history"]["segments"] = historyLog.getSegmentCount();
+    doc["history"]["recordsWritten"] = historyLog.getRecordsWritten();
+    doc["history"]["writeErrors"] = historyLog.getWriteErrors();
+    doc["history"]["skippedNoClock"] = historyLog.getSkippedNoClock();
+  }
+  
+  // State snapshot (readRetries = reads that overlapped a publish)
+  if (sections & SECTION_STATE_SNAPSHOT) {
+    doc["stateSnapshot"]["iteration"] = state.iteration;
+    doc["stateSnapshot"]["ageMs"] = millis() - state.publishedAt;
+    doc["stateSnapshot"]["readRetries"] = systemState.getReadRetries();
+  }
+  return true;
 }
 
-// Handle parameter update API endpoint
-void WebInterface::handleUpdate(AsyncWebServerRequest *request) {
-  JsonDocument doc;
+// Handle status API endpoint - return the current system state
+// Allocation-free in steady state: the document lives in a fixed arena and
+// is serialized into a preallocated buffer that the response sends from
+// directly. The buffer stays reserved until the client disconnects.
+// Accept: application/msgpack returns the same document as MessagePack;
+// ?fields=thermostat,peltierTemp builds only the listed top-level keys;
+// ?since=<version> only the keys that changed after that version (304 if
+// none did). Every response carries the current "version".
+void WebInterface::handleStatus(AsyncWebServerRequest *request) {
+  statusStats.requests++;
+  AllocCounter::start();  // Heap check - see recordStatusHeap
   
-  // Parse request body (we'll get data from POST parameters for simplicity)
-  if (request->hasParam("setpointMode", true)) {
-    int newMode = request->getParam("setpointMode", true)->value().toInt();
-    
-    // Handle setpoint mode change
-    if (newMode == -1) {
-      // Switching to manual mode
-      if (request->hasParam("manualSetpoint", true)) {
-        manualSetpoint = request->getParam("manualSetpoint", true)->value().toFloat();
-        thermostat.setSetPoint(manualSetpoint);
-      }
-      setpointMode = -1;
-      doc["status"] = "ok";
-      doc["message"] = "Switched to manual mode";
-      
-    } else if (newMode >= 0 && newMode < NUM_STATIONS) {
-      // Switching to station-linked mode
-      setpointMode = newMode;
-      
-      // Enable WiFi and try to connect
-      if (!wifiManager.isConnected()) {
-        wifiManager.begin();  // Enable WiFi
-        if (wifiManager.connect()) {
-          // Successfully connected - fetch weather data
-          wifiManager.fetchWeather(stations, NUM_STATIONS);
-          manualSetpoint = stations[setpointMode].temperature;
-          thermostat.setSetPoint(manualSetpoint);
-          doc["status"] = "ok";
-          doc["message"] = "Connected to WiFi and linked to station";
-        } else {
-          // Connection failed - revert to manual
-          setpointMode = -1;
-          doc["status"] = "error";
-          doc["message"] = "WiFi connection failed, staying in manual mode";
-        }
-      } else {
-        // Already connected - just update setpoint
-        wifiManager.fetchWeather(stations, NUM_STATIONS);
-        manualSetpoint = stations[setpointMode].temperature;
-        thermostat.setSetPoint(manualSetpoint);
-        doc["status"] = "ok";
-        doc["message"] = "Linked to station";
+  uint32_t sections = SECTION_ALL;
+  if (request->hasParam("fields") &&
+      !parseStatusFields(request->getParam("fields")->value().c_str(), sections)) {
+    AllocCounter::stop();
+    request->send(400, "application/json", "{\"status\":\"error\",\"message\":\"Unknown field in fields=\"}");
+    return;
+  }
+  uint32_t since = 0;
+  if (request->hasParam("since")) {
+    since = strtoul(request->getParam("since")->value().c_str(), nullptr, 10);
+    statusStats.deltas++;
+  }
+  bool msgpack = request->hasHeader("Accept") &&
+                 request->getHeader("Accept")->value().indexOf("msgpack") >= 0;
+  
+  StatusBuffer* buffer = acquireStatusBuffer();
+  if (buffer == nullptr) {
+    AllocCounter::stop();
+    statusStats.busyRejects++;
+    request->send(503, "application/json", "{\"status\":\"error\",\"message\":\"Busy, retry\"}");
+    return;
+  }
+  
+  unsigned long start = micros();
+  uint32_t fallbacksBefore = statusArena.getHeapFallbacks();
+  size_t length = 0;
+  bool modified;
+  {
+    statusArena.reset();
+    JsonDocument doc(&statusArena);
+    modified = buildStatus(doc, sections, since);
+    if (!modified) {
+      // Nothing to send
+    } else if (msgpack) {
+      if (measureMsgPack(doc) <= sizeof(buffer->data)) {
+        length = serializeMsgPack(doc, buffer->data, sizeof(buffer->data));
       }
+    } else if (measureJson(doc) < sizeof(buffer->data)) {
+      length = serializeJson(doc, buffer->data, sizeof(buffer->data));
     }
   }
+  recordStatusHeap(AllocCounter::stop(), fallbacksBefore);  // Before any response is sent
+  
+  if (!modified) {
+    statusStats.notModified++;
+    buffer->busy = false;
+    request->send(304);
+    return;
+  }
   
-  // Update other parameters if provided
-  bool settingsChanged = false;
+  if (length == 0) {
+    statusStats.overflows++;  // STATUS_BUFFER_SIZE too small
+    buffer->busy = false;
+    request->send(500, "application/json", "{\"status\":\"error\",\"message\":\"Status too large\"}");
+    return;
+  }
   
-  if (request->hasParam("reactivateTemp", true)) {
-    float temp = request->getParam("reactivateTemp", true)->value().toFloat();
-    thermostat.setReactivateTemp(temp);
-    settingsManager.currentSettings.reactivateTemp = temp;
-    settingsChanged = true;
+  FormatStats& format = msgpack ? statusStats.msgpack : statusStats.json;
+  format.responses++;
+  format.bytes += length;
+  format.micros += micros() - start;
+  
+  sendStatusBuffer(request, buffer, length, msgpack ? "application/msgpack" : "application/json");
+}
+
+// Handle metrics endpoint - Prometheus text exposition format
+// Written with a MetricsWriter into a preallocated buffer and sent from it
+// directly (no JsonDocument, no String). One scrape at a time.
+void WebInterface::handleMetrics(AsyncWebServerRequest *request) {
+  if (metricsBusy) {
+    request->send(503, "text/plain", "Busy, retry\n");
+    return;
   }
+  metricsBusy = true;
   
-  if (request->hasParam("manualSetpoint", true)) {
-    manualSetpoint = request->getParam("manualSetpoint", true)->value().toFloat();
-    settingsManager.currentSettings.manualSetpoint = manualSetpoint;
-    // Update thermostat if in manual mode
-    if (setpointMode == -1) {
-      thermostat.setSetPoint(manualSetpoint);
+  systemState.read(metricsState);
+  const SystemState::Snapshot& state = metricsState;
+  MetricsWriter m(metricsBuffer, sizeof(metricsBuffer));
+  
+  // Drops and thermostat
+  m.counter("meteorite_drops_total", "Drops detected since boot", state.dropCount);
+  m.counter("meteorite_peltier_on_seconds_total", "Time the Peltier has been cooling", state.coolingMs / 1000.0);
+  m.counter("meteorite_thermostat_transitions_total", "Peltier on/off switches", state.transitions);
+  m.gauge("meteorite_peltier_cooling", "1 while the Peltier is cooling", state.cooling ? 1 : 0);
+  m.gauge("meteorite_plate_temperature_celsius", "Peltier plate (ice) temperature", state.peltierTemp);
+  m.gauge("meteorite_setpoint_celsius", "Thermostat setpoint", state.setpoint);
+  m.gauge("meteorite_reactivate_temperature_celsius", "Temperature that restarts cooling", state.reactivateTemp);
+  m.gauge("meteorite_system_running", "0 while paused from the dashboard", state.systemRunning ? 1 : 0);
+  
+  // Hardware status
+  m.family("meteorite_hardware_ok", "gauge", "1 if the component initialized");
+  m.sample("meteorite_hardware_ok", "component", "temp_sensor", state.hwTempSensor);
+  m.sample("meteorite_hardware_ok", "component", "drop_detector", state.hwDropDetector);
+  m.sample("meteorite_hardware_ok", "component", "neopixel", state.hwNeoPixel);
+  m.sample("meteorite_hardware_ok", "component", "audio_player", state.hwAudioPlayer);
+  m.sample("meteorite_hardware_ok", "component", "wifi", state.hwWiFi);
+  m.sample("meteorite_hardware_ok", "component", "web_server", state.hwWebServer);
+  
+  // Weather stations (stations without a reading are left out)
+  m.family("meteorite_weather_age_seconds", "gauge", "Age of the station reading");
+  for (int i = 0; i < state.numStations; i++) {
+    if (state.stations[i].ageSec >= 0) {
+      m.sample("meteorite_weather_age_seconds", "station", state.stations[i].name, state.stations[i].ageSec);
     }
-    settingsChanged = true;
+  }
+  m.family("meteorite_weather_temperature_celsius", "gauge", "Station temperature (interpolated between fetches)");
+  for (int i = 0; i < state.numStations; i++) {
+    m.sample("meteorite_weather_temperature_celsius", "station", state.stations[i].name, state.stations[i].temperature);
   }
   
-  if (request->hasParam("freezeDuration", true)) {
-    unsigned long duration = request->getParam("freezeDuration", true)->value().toInt();
-    settingsManager.currentSettings.durationGlacierFreezing = duration;
-    settingsChanged = true;
+  // Weather fetches
+  const WiFiManager::HttpStats& http = wifiManager.getHttpStats();
+  m.counter("meteorite_weather_fetches_total", "Weather fetch rounds", http.fetches);
+  m.counter("meteorite_weather_fetch_seconds_total", "Time spent in weather fetch rounds", http.fetchTimeMs / 1000.0);
+  m.gauge("meteorite_weather_fetch_last_seconds", "Duration of the last weather fetch round", http.lastFetchMs / 1000.0);
+  m.counter("meteorite_weather_http_requests_total", "Weather API requests", http.requests);
+  m.counter("meteorite_weather_http_errors_total", "Failed weather API requests", http.errors);
+  m.counter("meteorite_weather_http_handshakes_total", "New weather API connections", http.handshakes);
+  m.counter("meteorite_weather_http_reused_total", "Weather API requests sent on a kept-alive connection", http.reusedRequests);
+  m.counter("meteorite_weather_http_closed_after_response_total", "Weather API connections closed by the server after a complete response", http.closedAfterResponse);
+  
+  // WiFi
+  bool stationConnected = (WiFi.status() == WL_CONNECTED);
+  m.gauge("meteorite_wifi_connected", "1 while connected to the WiFi network", stationConnected ? 1 : 0);
+  if (stationConnected) {
+    m.gauge("meteorite_wifi_rssi_dbm", "WiFi signal strength", WiFi.RSSI());
   }
+  m.counter("meteorite_wifi_disconnects_total", "WiFi links lost after connecting", wifiManager.getConnStats().disconnects);
   
-  if (request->hasParam("reactivateTimer", true)) {
-    unsigned long timer = request->getParam("reactivateTimer", true)->value().toInt();
-    settingsManager.currentSettings.reactivateTimer = timer;
-    settingsChanged = true;
+  // Memory and uptime
+  m.gauge("meteorite_heap_free_bytes", "Free heap", ESP.getFreeHeap());
+  m.gauge("meteorite_heap_largest_free_block_bytes", "Largest allocatable heap block", ESP.getMaxAllocHeap());
+  m.gauge("meteorite_heap_min_free_bytes", "Lowest free heap since boot", ESP.getMinFreeHeap());
+  m.gauge("meteorite_uptime_seconds", "Time since boot", millis() / 1000.0);
+  
+  // loop() timing
+  m.counter("meteorite_loop_iterations_total", "loop() iterations", state.iteration);
+  m.family("meteorite_loop_stage_seconds_total", "counter", "Time spent in each loop() stage");
+  for (int i = 0; i < SystemState::NUM_LOOP_STAGES; i++) {
+    m.sample("meteorite_loop_stage_seconds_total", "stage", SystemState::stageName(i), state.stageUs[i] / 1e6);
+  }
+  m.family("meteorite_loop_stage_max_seconds", "gauge", "Slowest single pass of each loop() stage since boot");
+  for (int i = 0; i < SystemState::NUM_LOOP_STAGES; i++) {
+    m.sample("meteorite_loop_stage_max_seconds", "stage", SystemState::stageName(i), state.stageMaxUs[i] / 1e6);
   }
   
-  if (request->hasParam("ledFadeTime", true)) {
-    uint16_t fadeTime = request->getParam("ledFadeTime", true)->value().toInt();
-    settingsManager.currentSettings.ledFadeTotalTime = fadeTime;
-    // TODO: Update NeoPixelController fade time if needed
-    settingsChanged = true;
+  // Web server
+  m.family("meteorite_http_requests_total", "counter", "Web requests per route");
+  for (int i = 0; i < numRoutes; i++) {
+    m.sample("meteorite_http_requests_total", "method", routeStats[i].method,
+             "route", routeStats[i].uri, routeStats[i].requests);
   }
+  m.counter("meteorite_http_not_found_total", "Web requests for unknown paths", notFoundRequests);
+  m.gauge("meteorite_sse_clients", "Connected event stream clients", events.count());
+  m.counter("meteorite_commands_executed_total", "Web commands run by loop()", commandQueue.getCommandsExecuted());
+  m.counter("meteorite_commands_rejected_total", "Web commands refused (queue full)", commandQueue.getCommandsRejected());
   
-  if (request->hasParam("ledBrightness", true)) {
-    uint8_t brightness = request->getParam("ledBrightness", true)->value().toInt();
-    settingsManager.currentSettings.neopixelBrightness = brightness;
-    // TODO: Update NeoPixelController brightness if needed
-    settingsChanged = true;
+  // Settings persistence (flash wear)
+  m.counter("meteorite_settings_saves_total", "Settings saves that wrote to flash", settingsManager.getSaves());
+  m.counter("meteorite_settings_key_writes_total", "Settings keys written to flash", settingsManager.getKeyWrites());
+  m.counter("meteorite_settings_saves_coalesced_total", "Setting changes merged into a pending save",
+            settingsManager.getRequestsCoalesced());
+  
+  // History log
+  m.counter("meteorite_history_records_total", "History records written to flash", historyLog.getRecordsWritten());
+  m.counter("meteorite_history_write_errors_total", "Failed history flash writes", historyLog.getWriteErrors());
+  
+  if (m.overflowed()) {
+    metricsBusy = false;
+    request->send(500, "text/plain", "Metrics too large (METRICS_BUFFER_SIZE)\n");
+    return;
   }
   
+  AsyncWebServerResponse *response = request->beginResponse_P(200, "text/plain; version=0.0.4",
+                                                              (const uint8_t*)metricsBuffer, m.getLength());
+  request->onDisconnect([]() { metricsBusy = false; });
+  request->send(response);
+}
+
+// Handle parameter update API endpoint
+// Parameters are collected into a SettingsUpdate and applied by loop()
+void WebInterface::handleUpdate(AsyncWebServerRequest *request) {
+  CommandQueue::Command cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type = CommandQueue::CMD_UPDATE;
+  CommandQueue::SettingsUpdate& u = cmd.update;
+  
+  if (request->hasParam("setpointMode", true)) {
+    u.setpointMode = request->getParam("setpointMode", true)->value().toInt();
+    u.fields |= CommandQueue::FIELD_SETPOINT_MODE;
+  }
+  if (request->hasParam("manualSetpoint", true)) {
+    u.manualSetpoint = request->getParam("manualSetpoint", true)->value().toFloat();
+    u.fields |= CommandQueue::FIELD_MANUAL_SETPOINT;
+  }
+  if (request->hasParam("reactivateTemp", true)) {
+    u.reactivateTemp = request->getParam("reactivateTemp", true)->value().toFloat();
+    u.fields |= CommandQueue::FIELD_REACTIVATE_TEMP;
+  }
+  if (request->hasParam("freezeDuration", true)) {
+    u.freezeDuration = request->getParam("freezeDuration", true)->value().toInt();
+    u.fields |= CommandQueue::FIELD_FREEZE_DURATION;
+  }
+  if (request->hasParam("reactivateTimer", true)) {
+    u.reactivateTimer = request->getParam("reactivateTimer", true)->value().toInt();
+    u.fields |= CommandQueue::FIELD_REACTIVATE_TIMER;
+  }
+  if (request->hasParam("ledFadeTime", true)) {
+    u.ledFadeTime = request->getParam("ledFadeTime", true)->value().toInt();
+    u.fields |= CommandQueue::FIELD_LED_FADE_TIME;
+  }
+  if (request->hasParam("ledBrightness", true)) {
+    u.ledBrightness = request->getParam("ledBrightness", true)->value().toInt();
+    u.fields |= CommandQueue::FIELD_LED_BRIGHTNESS;
+  }
   if (request->hasParam("cubeLight", true)) {
-    bool cubeLight = request->getParam("cubeLight", true)->value().toInt();
-    settingsManager.currentSettings.cubeLight = cubeLight;
-    settingsChanged = true;
+    u.cubeLight = request->getParam("cubeLight", true)->value().toInt();
+    u.fields |= CommandQueue::FIELD_CUBE_LIGHT;
   }
-  
   if (request->hasParam("cubeLightBrightness", true)) {
-    uint8_t cubeBrightness = request->getParam("cubeLightBrightness", true)->value().toInt();
-    settingsManager.currentSettings.cubeLightBrightness = cubeBrightness;
-    settingsChanged = true;
+    u.cubeLightBrightness = request->getParam("cubeLightBrightness", true)->value().toInt();
+    u.fields |= CommandQueue::FIELD_CUBE_BRIGHTNESS;
   }
   
-  // Save to EEPROM if any setting changed
-  if (settingsChanged) {
-    settingsManager.saveToEEPROM();
-    Serial.println("Settings updated and saved to EEPROM");
+  postCommand(request, cmd);
+}
+
+// Collect a small request body (see routeBody)
+void WebInterface::collectBody(AsyncWebServerRequest *request, uint8_t *data,
+                               size_t len, size_t index, size_t total) {
+  if (total > WEB_MAX_BODY_SIZE) return;
+  if (index == 0 && request->_tempObject == nullptr) {
+    request->_tempObject = calloc(total + 1, 1);
+  }
+  if (request->_tempObject != nullptr && index + len <= total) {
+    memcpy((uint8_t*)request->_tempObject + index, data, len);
   }
-  
-  String response;
-  serializeJson(doc, response);
-  request->send(200, "application/json", response);
 }
 
-// Handle drop trigger API endpoint
-void WebInterface::handleDrop(AsyncWebServerRequest *request) {
-  JsonDocument doc;
-  
-  // Simulate drop detection (same as physical button)
-  dropCount++; // Increment drop counter
+// Fields accepted by /api/settings (units as in /api/update)
+static const struct {
+  uint16_t field;
+  double min;
+  double max;
+  bool integer;
+} settingsRanges[] = {
+  {CommandQueue::FIELD_SETPOINT_MODE,    -1, WEATHER_MAX_STATIONS - 1, true},
+  {CommandQueue::FIELD_MANUAL_SETPOINT,  SETTING_TEMP_MIN, SETTING_TEMP_MAX, false},
+  {CommandQueue::FIELD_REACTIVATE_TEMP,  SETTING_TEMP_MIN, SETTING_TEMP_MAX, false},
+  {CommandQueue::FIELD_FREEZE_DURATION,  SETTING_FREEZE_DURATION_MIN, SETTING_FREEZE_DURATION_MAX, true},
+  {CommandQueue::FIELD_REACTIVATE_TIMER, SETTING_REACTIVATE_TIMER_MIN, SETTING_REACTIVATE_TIMER_MAX, true},
+  {CommandQueue::FIELD_LED_FADE_TIME,    0, SETTING_LED_FADE_TIME_MAX, true},
+  {CommandQueue::FIELD_LED_BRIGHTNESS,   0, 255, true},
+  {CommandQueue::FIELD_CUBE_LIGHT,       0, 1, true},
+  {CommandQueue::FIELD_CUBE_BRIGHTNESS,  0, 255, true},
+};
+
+// Check one field of a batch update and store it in u
+// Returns nullptr if valid, otherwise the problem (written to problem).
+static const char* parseSettingsField(const char* name, JsonVariantConst value,
+                                      CommandQueue::SettingsUpdate& u, char (&problem)[64]) {
+  for (const auto& range : settingsRanges) {
+    if (strcmp(CommandQueue::fieldName(range.field), name) != 0) continue;
+    
+    double number;
+    if (value.is<bool>()) {
+      if (range.field != CommandQueue::FIELD_CUBE_LIGHT) return "must be a number";
+      number = value.as<bool>() ? 1 : 0;
+    } else if (value.is<double>()) {
+      number = value.as<double>();
+    } else {
+      return "must be a number";
+    }
+    if (isnan(number) || number < range.min || number > range.max) {
+      snprintf(problem, sizeof(problem), "out of range (%g to %g)", range.min, range.max);
+      return problem;
+    }
+    if (range.integer && number != floor(number)) return "must be a whole number";
+    if (range.field == CommandQueue::FIELD_SETPOINT_MODE && number >= 0 &&
+        !stationRegistry.isValidIndex((int)number)) {
+      return "unknown station";
+    }
+    
+    switch (range.field) {
+      case CommandQueue::FIELD_SETPOINT_MODE:    u.setpointMode = (int)number; break;
+      case CommandQueue::FIELD_MANUAL_SETPOINT:  u.manualSetpoint = number; break;
+      case CommandQueue::FIELD_REACTIVATE_TEMP:  u.reactivateTemp = number; break;
+      case CommandQueue::FIELD_FREEZE_DURATION:  u.freezeDuration = (uint32_t)number; break;
+      case CommandQueue::FIELD_REACTIVATE_TIMER: u.reactivateTimer = (uint32_t)number; break;
+      case CommandQueue::FIELD_LED_FADE_TIME:    u.ledFadeTime = (uint16_t)number; break;
+      case CommandQueue::FIELD_LED_BRIGHTNESS:   u.ledBrightness = (uint8_t)number; break;
+      case CommandQueue::FIELD_CUBE_LIGHT:       u.cubeLight = number != 0; break;
+      case CommandQueue::FIELD_CUBE_BRIGHTNESS:  u.cubeLightBrightness = (uint8_t)number; break;
+    }
+    u.fields |= range.field;
+    return nullptr;
+  }
+  return "unknown field";
+}
+
+// Handle batch settings update - JSON body with any of the /api/update
+// fields, e.g. {"manualSetpoint": -2.5, "ledBrightness": 200}
+// Every field is checked against its range before anything is applied; if
+// one fails the reply (400) lists each field's outcome and nothing changes.
+// A valid set is applied by loop() in one step and saved once; the reply
+// marks each field "applied" or "unchanged".
+void WebInterface::handleSettings(AsyncWebServerRequest *request) {
+  const char* body = (const char*)request->_tempObject;
+  if (body == nullptr) {
+    if (request->contentLength() > WEB_MAX_BODY_SIZE) {
+      request->send(413, "application/json", "{\"status\":\"error\",\"message\":\"Body too large\"}");
+    } else {
+      request->send(400, "application/json", "{\"status\":\"error\",\"message\":\"JSON body required\"}");
+    }
+    return;
+  }
   
-  // 1. Trigger LED fade cycle
-  neoPixels.onDropDetected(cachedPeltierTemperature, thermostat.getSetPoint());
+  JsonDocument input;
+  if (deserializeJson(input, body) || !input.is<JsonObject>()) {
+    request->send(400, "application/json", "{\"status\":\"error\",\"message\":\"Body must be a JSON object\"}");
+    return;
+  }
   
-  // 2. Play audio sample
-  audioPlayer.playDropSound();
+  CommandQueue::Command cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type = CommandQueue::CMD_UPDATE_BATCH;
   
-  // 3. Force peltier to reactivate immediately
-  thermostat.forceActivate();
+  JsonDocument doc;
+  JsonObject fields = doc["fields"].to<JsonObject>();
+  bool valid = true;
+  for (JsonPairConst field : input.as<JsonObjectConst>()) {
+    char problem[64];
+    const char* error = parseSettingsField(field.key().c_str(), field.value(), cmd.update, problem);
+    fields[field.key().c_str()] = error ? error : "ok";  // Copied into doc (problem is per field)
+    if (error) valid = false;
+  }
   
-  doc["status"] = "ok";
-  doc["message"] = "Drop triggered!";
-  doc["dropCount"] = dropCount;
+  if (!valid || cmd.update.fields == 0) {
+    doc["status"] = "error";
+    doc["message"] = valid ? "No fields given" : "Nothing applied";
+    String response;
+    serializeJson(doc, response);
+    request->send(400, "application/json", response);
+    return;
+  }
   
-  String response;
-  serializeJson(doc, response);
-  request->send(200, "application/json", response);
+  postCommand(request, cmd);
+}
+
+// Handle drop trigger API endpoint (same as the LCD button)
+void WebInterface::handleDrop(AsyncWebServerRequest *request) {
+  postCommand(request, CommandQueue::CMD_DROP);
 }
 
 // Handle Peltier toggle - force ON or OFF (without breaking thermostat logic)
 void WebInterface::handleTogglePeltier(AsyncWebServerRequest *request) {
+  postCommand(request, CommandQueue::CMD_TOGGLE_PELTIER);
+}
+
+// Handle Peltier test - force ON for 5 seconds
+void WebInterface::handleTestPeltier(AsyncWebServerRequest *request) {
+  postCommand(request, CommandQueue::CMD_TEST_PELTIER);
+}
+
+// Handle LED test - full white for 5 seconds
+void WebInterface::handleTestLED(AsyncWebServerRequest *request) {
+  postCommand(request, CommandQueue::CMD_TEST_LED);
+}
+
+// Handle Audio test - play drop sound
+void WebInterface::handleTestAudio(AsyncWebServerRequest *request) {
+  postCommand(request, CommandQueue::CMD_TEST_AUDIO);
+}
+
+// Handle Reset to Defaults - restore all settings from config.h
+// loop() restarts the device once the reply had time to go out
+void WebInterface::handleReset(AsyncWebServerRequest *request) {
+  postCommand(request, CommandQueue::CMD_RESET);
+}
+
+// Handle System Toggle - pause/resume thermostat and sensor updates
+void WebInterface::handleToggleSystem(AsyncWebServerRequest *request) {
+  postCommand(request, CommandQueue::CMD_TOGGLE_SYSTEM);
+}
+
+// Handle latency API endpoint - drop-to-feedback histograms (microseconds)
+void WebInterface::handleLatency(AsyncWebServerRequest *request) {
   JsonDocument doc;
   
-  if (thermostat.isCooling()) {
-    // Currently ON - turn it OFF
-    thermostat.turnOff();
-    doc["message"] = "Peltier turned OFF (will restart based on thermostat logic)";
-  } else {
-    // Currently OFF - force it ON for 5 seconds
-    thermostat.forceActivate();
-    doc["message"] = "Peltier forced ON for 5 seconds";
-  }
-  
-  doc["status"] = "ok";
+  latencyProbe.toJson(doc["latency"].to<JsonObject>());
   
   String response;
   serializeJson(doc, response);
   request->send(200, "application/json", response);
 }
 
-// Handle Peltier test - force ON for 5 seconds
-void WebInterface::handleTestPeltier(AsyncWebServerRequest *request) {
+// Handle latency reset - clear all histograms (e.g. before measuring a change)
+void WebInterface::handleLatencyReset(AsyncWebServerRequest *request) {
   JsonDocument doc;
   
-  // Force peltier ON for 5 seconds (thermostat will override after that)
-  thermostat.forceActivate();
+  latencyProbe.reset();
   
   doc["status"] = "ok";
-  doc["message"] = "Peltier forced ON for 5 seconds";
+  doc["message"] = "Latency histograms cleared";
   
   String response;
   serializeJson(doc, response);
   request->send(200, "application/json", response);
 }
 
-// Handle LED test - full white for 5 seconds
-void WebInterface::handleTestLED(AsyncWebServerRequest *request) {
-  JsonDocument doc;
+// Handle history API endpoint - stream recorded records for a time range
+// Params: from/to (Unix time, default: oldest record / now) or range
+// (seconds before now), points (downsample to about this many buckets,
+// default: every record), format (csv or bin - see HistoryStream).
+// Streamed as a chunked response; memory use does not depend on the range.
+void WebInterface::handleHistory(AsyncWebServerRequest *request) {
+  if (!historyLog.isMounted()) {
+    request->send(503, "application/json", "{\"status\":\"error\",\"message\":\"History storage not available\"}");
+    return;
+  }
   
-  // Set LEDs to full white
-  neoPixels.fill(255, 255, 255);
-  neoPixels.show();
+  uint32_t now = WeatherCache::nowEpoch();
+  uint32_t to = now ? now : historyLog.getLastEpoch();
+  uint32_t from = 0;
+  if (request->hasParam("to")) {
+    to = strtoul(request->getParam("to")->value().c_str(), nullptr, 10);
+  }
+  if (request->hasParam("from")) {
+    from = strtoul(request->getParam("from")->value().c_str(), nullptr, 10);
+  } else if (request->hasParam("range")) {
+    uint32_t range = strtoul(request->getParam("range")->value().c_str(), nullptr, 10);
+    from = (to > range) ? to - range : 0;
+  }
+  if (from == 0) {
+    from = HistoryStream::oldestEpoch();
+  }
   
-  // Note: LEDs will stay white until next update or fade
-  // User can trigger another action to change them
+  long points = request->hasParam("points") ? request->getParam("points")->value().toInt() : 0;
+  bool csv = true;
+  if (request->hasParam("format")) {
+    const String& format = request->getParam("format")->value();
+    if (format == "bin") {
+      csv = false;
+    } else if (format != "csv") {
+      request->send(400, "application/json", "{\"status\":\"error\",\"message\":\"format must be csv or bin\"}");
+      return;
+    }
+  }
+  if (points < 0 || points > HISTORY_MAX_POINTS || to < from) {
+    request->send(400, "application/json", "{\"status\":\"error\",\"message\":\"Invalid range or points\"}");
+    return;
+  }
   
-  doc["status"] = "ok";
-  doc["message"] = "LED test running (5 seconds)";
+  // Bucket width for downsampling (never finer than the recording interval)
+  uint32_t bucketSec = 0;
+  if (points > 0) {
+    bucketSec = max((uint32_t)((to - from) / points + 1), (uint32_t)(HISTORY_SAMPLE_INTERVAL / 1000));
+  }
   
-  String response;
-  serializeJson(doc, response);
-  request->send(200, "application/json", response);
+  if (!HistoryStream::acquire()) {
+    request->send(503, "application/json", "{\"status\":\"error\",\"message\":\"Busy, retry\"}");
+    return;
+  }
+  std::shared_ptr<HistoryStream> stream = std::make_shared<HistoryStream>(from, to, bucketSec, csv);
+  AsyncWebServerResponse *response = request->beginChunkedResponse(stream->contentType(),
+    [stream](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+      return stream->fill(buffer, maxLen);
+    });
+  response->addHeader("Cache-Control", "no-store");
+  request->send(response);
 }
 
-// Handle Audio test - play drop sound
-void WebInterface::handleTestAudio(AsyncWebServerRequest *request) {
+// Stream a firmware upload into the OTA partition, chunk by chunk
+void WebInterface::receiveFirmware(AsyncWebServerRequest *request, uint8_t *data,
+                                   size_t len, size_t index, size_t total) {
+  if (index == 0) {
+    const char* sha256 = request->hasHeader("X-Firmware-SHA256")
+                           ? request->getHeader("X-Firmware-SHA256")->value().c_str() : "";
+    const char* signature = request->hasHeader("X-Firmware-Signature")
+                              ? request->getHeader("X-Firmware-Signature")->value().c_str() : "";
+    if (!otaUpdater.begin(request, total, sha256, signature)) return;
+    request->onDisconnect([request]() { otaUpdater.abort(request); });
+  }
+  otaUpdater.write(request, data, len);
+}
+
+// Handle firmware upload - the raw image is the request body
+// Header X-Firmware-SHA256: hex SHA-256 of the image (required), and
+// X-Firmware-Signature: its HMAC with OTA_SECRET (required). The image
+// was written while it arrived (receiveFirmware); here it is verified and
+// made the boot partition, then loop() restarts into it. The new firmware
+// has to pass its health checks or the previous one boots again.
+void WebInterface::handleOta(AsyncWebServerRequest *request) {
   JsonDocument doc;
+  String response;
   
-  // Play audio sample
-  audioPlayer.playDropSound();
+  if (!otaUpdater.finish(request)) {
+    doc["status"] = "error";
+    doc["message"] = otaUpdater.getError(request);
+    serializeJson(doc, response);
+    int code = otaUpdater.isUnauthorized(request) ? 401 : otaUpdater.isBusy(request) ? 409 : 400;
+    request->send(code, "application/json", response);
+    return;
+  }
   
+  const OtaUpdater::Stats& stats = otaUpdater.getStats();
   doc["status"] = "ok";
-  doc["message"] = "Audio playing";
-  
-  String response;
+  doc["message"] = "Firmware verified, restarting";
+  doc["bytes"] = stats.lastBytes;
+  doc["ms"] = stats.lastMs;
+  doc["kBps"] = stats.lastMs ? stats.lastBytes / (float)stats.lastMs : 0.0;  // bytes/ms = kB/s
   serializeJson(doc, response);
   request->send(200, "application/json", response);
+  
+  CommandQueue::Command cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type = CommandQueue::CMD_RESTART;
+  if (commandQueue.post(cmd) == 0) {
+    Serial.println("OTA: command queue full - restart manually to run the new firmware");
+  }
 }
 
-// Handle Reset to Defaults - restore all settings from config.h
-void WebInterface::handleReset(AsyncWebServerRequest *request) {
+// Handle firmware update state - upload progress, last result, trial boot
+void WebInterface::handleOtaStatus(AsyncWebServerRequest *request) {
   JsonDocument doc;
+  const OtaUpdater::Stats& stats = otaUpdater.getStats();
+  const esp_partition_t* running = esp_ota_get_running_partition();
+  const esp_partition_t* next = esp_ota_get_next_update_partition(nullptr);
   
-  Serial.println("Resetting to defaults...");
-  settingsManager.resetToDefaults();
-  
-  doc["status"] = "ok";
-  doc["message"] = "Settings reset to defaults. Device will restart in 3 seconds...";
+  doc["running"] = running ? running->label : "";
+  doc["next"] = next ? next->label : "";
+  doc["boot"] = OtaUpdater::bootStateName(otaUpdater.getBootState());
+  doc["upload"] = OtaUpdater::uploadStateName(otaUpdater.getUploadState());
+  if (otaUpdater.getUploadState() == OtaUpdater::UPLOAD_RECEIVING) {
+    doc["received"] = otaUpdater.getReceived();
+    doc["size"] = otaUpdater.getExpectedSize();
+  } else if (otaUpdater.getUploadState() == OtaUpdater::UPLOAD_FAILED) {
+    doc["error"] = otaUpdater.getLastError();
+  }
+  doc["uploads"] = stats.uploads;
+  doc["failures"] = stats.failures;
+  doc["lastBytes"] = stats.lastBytes;
+  doc["lastMs"] = stats.lastMs;
+  doc["lastKBps"] = stats.lastMs ? stats.lastBytes / (float)stats.lastMs : 0.0;
   
   String response;
   serializeJson(doc, response);
   request->send(200, "application/json", response);
-  
-  // Restart device after a short delay
-  delay(1000);
-  ESP.restart();
 }
 
-// Handle System Toggle - pause/resume thermostat and sensor updates
-void WebInterface::handleToggleSystem(AsyncWebServerRequest *request) {
-  JsonDocument doc;
-  
-  systemRunning = !systemRunning;  // Toggle the flag
+// Fill a JSON object with one station's configuration
+// The configuration comes from a locked registry copy, the reading from the
+// loop() snapshot (omitted if the station list changed in between).
+static void stationToJson(JsonObject obj, int index, const WeatherStation& s, int local, int linked,
+                          const SystemState::Snapshot& state) {
+  obj["index"] = index;
+  obj["name"] = s.name;
+  obj["lat"] = s.lat;
+  obj["lon"] = s.lon;
+  obj["timezone"] = s.timezone;
+  obj["intervalMin"] = StationRegistry::fetchIntervalOf(s) / 60000;
+  obj["priority"] = s.priority;
+  obj["displayed"] = s.displayed;
+  obj["local"] = (index == local);
+  obj["linked"] = (index == linked);
+  obj["referenced"] = (index == local || index == linked || s.displayed);
+  if (index < state.numStations && strcmp(state.stations[index].name, s.name) == 0) {
+    obj["temp"] = state.stations[index].temperature;
+    obj["ageSec"] = state.stations[index].ageSec;  // -1 = unknown
+  }
+}
+
+// Handle station list - the runtime station registry
+// loop() owns the registry; this reads a copy taken under the registry lock.
+void WebInterface::handleStations(AsyncWebServerRequest *request) {
+  int local = -1;
+  int linked = -1;
+  int count = stationRegistry.copyTo(stationsCopy, local, linked);
+  systemState.read(stationsState);
   
-  doc["status"] = "ok";
-  doc["running"] = systemRunning;
-  doc["message"] = systemRunning ? "System RESUMED" : "System PAUSED";
+  JsonDocument doc;
+  doc["capacity"] = WEATHER_MAX_STATIONS;
+  JsonArray list = doc["stations"].to<JsonArray>();
+  for (int i = 0; i < count; i++) {
+    stationToJson(list.add<JsonObject>(), i, stationsCopy[i], local, linked, stationsState);
+  }
   
   String response;
   serializeJson(doc, response);
   request->send(200, "application/json", response);
 }
+
+// Handle station add/update
+// Params: index (omit or -1 to add), name, lat, lon, timezone,
+//         interval (minutes), priority, displayed (0/1), local (0/1)
+// Values are range-checked here; loop() merges them into the station (fields
+// not given keep their value), persists the registry and replies.
+void WebInterface::handleStationUpdate(AsyncWebServerRequest *request) {
+  CommandQueue::Command cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type = CommandQueue::CMD_UPSERT_STATION;
+  CommandQueue::StationUpdate& u = cmd.station;
+  
+  long index = request->hasParam("index", true) ? request->getParam("index", true)->value().toInt() : -1;
+  u.index = (index < 0) ? -1 : (int8_t)min(index, (long)WEATHER_MAX_STATIONS);  // Out of range is rejected by loop()
+  
+  if (request->hasParam("name", true)) {
+    strlcpy(u.name, request->getParam("name", true)->value().c_str(), sizeof(u.name));
+    u.fields |= CommandQueue::STATION_NAME;
+  }
+  if (request->hasParam("timezone", true)) {
+    strlcpy(u.timezone, request->getParam("timezone", true)->value().c_str(), sizeof(u.timezone));
+    u.fields |= CommandQueue::STATION_TIMEZONE;
+  }
+  if (request->hasParam("lat", true) && request->hasParam("lon", true)) {
+    u.lat = request->getParam("lat", true)->value().toFloat();
+    u.lon = request->getParam("lon", true)->value().toFloat();
+    u.fields |= CommandQueue::STATION_LOCATION;
+  }
+  if (request->hasParam("interval", true)) {
+    long minutes = request->getParam("interval", true)->value().toInt();
+    u.fetchInterval = (minutes > 0) ? (uint32_t)minutes * 60000UL : 0;  // 0 = default interval
+    u.fields |= CommandQueue::STATION_INTERVAL;
+  }
+  if (request->hasParam("priority", true)) {
+    u.priority = constrain(request->getParam("priority", true)->value().toInt(), 0, 255);
+    u.fields |= CommandQueue::STATION_PRIORITY;
+  }
+  if (request->hasParam("displayed", true)) {
+    u.displayed = request->getParam("displayed", true)->value().toInt() != 0;
+    u.fields |= CommandQueue::STATION_DISPLAYED;
+  }
+  if (request->hasParam("local", true)) {
+    u.local = request->getParam("local", true)->value().toInt() != 0;
+    u.fields |= CommandQueue::STATION_LOCAL;
+  }
+  
+  if (((u.fields & CommandQueue::STATION_NAME) && u.name[0] == '\0') ||
+      u.lat < -90.0 || u.lat > 90.0 || u.lon < -180.0 || u.lon > 180.0 ||
+      (u.fetchInterval != 0 && u.fetchInterval < WEATHER_MIN_FETCH_INTERVAL)) {
+    request->send(400, "application/json",
+                  "{\"status\":\"error\",\"message\":\"Invalid station (name, lat/lon and interval >= 15 min required)\"}");
+    return;
+  }
+  
+  postCommand(request, cmd);
+}
+
+// Handle station removal (later stations shift down by one)
+// Executed by loop(), which also keeps a linked setpoint on the same station
+void WebInterface::handleStationDelete(AsyncWebServerRequest *request) {
+  CommandQueue::Command cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type = CommandQueue::CMD_DELETE_STATION;
+  cmd.arg = request->hasParam("index", true) ? request->getParam("index", true)->value().toInt() : -1;
+  postCommand(request, cmd);
+}
@@ -3,7 +3,9 @@
 
 #include <ESPAsyncWebServer.h>
 #include <WiFi.h>
+#include <ArduinoJson.h>
 #include "config.h"
+#include "CommandQueue.h"
 
 class WebInterface {
 private:
@@ -13,13 +15,157 @@ private:
   IPAddress apIP;
   IPAddress stationIP;
   
-  // HTML page content
-  String getHTML();
+  // Server-Sent Events channel (/api/events) - pushes compact status updates
+  // when values change, so the dashboard does not have to poll every 2 s
+  AsyncEventSource events;
+  
+  // Last pushed values (compared at display precision)
+  struct PushState {
+    bool cooling;
+    long setpointTenths;
+    long peltierTenths;
+    int dropCount;
+    bool systemRunning;
+    int setpointMode;
+    bool wifi;
+  };
+  PushState lastPush;
+  bool hasLastPush;
+  unsigned long lastPushTime;
+  uint32_t pushId;
+  volatile bool refreshPending;  // Tell clients to fetch the full /api/status
+  
+  // Status serialization (see handleStatus)
+public:
+  struct StatusBuffer {
+    char data[STATUS_BUFFER_SIZE];
+    volatile bool busy;        // Reserved until the response is fully sent
+  };
+  
+  // Top-level sections of /api/status (?fields= selects a subset)
+  enum StatusSection : uint32_t {
+    SECTION_THERMOSTAT      = 1 << 0,
+    SECTION_PELTIER_TEMP    = 1 << 1,
+    SECTION_DROP_COUNT      = 1 << 2,
+    SECTION_SETPOINT_MODE   = 1 << 3,
+    SECTION_MANUAL_SETPOINT = 1 << 4,
+    SECTION_HARDWARE        = 1 << 5,
+    SECTION_WEATHER         = 1 << 6,
+    SECTION_NETWORK         = 1 << 7,
+    SECTION_WEATHER_CLIENT  = 1 << 8,
+    SECTION_SETTINGS        = 1 << 9,
+    SECTION_STATUS_WRITER   = 1 << 10,
+    SECTION_HISTORY         = 1 << 11,
+    SECTION_STATE_SNAPSHOT  = 1 << 12,
+    SECTION_ALL             = (1 << 13) - 1
+  };
+  
+private:
+  // Per-format serialization cost (JSON vs MessagePack, measured on device)
+  struct FormatStats {
+    uint32_t responses;
+    uint32_t bytes;
+    uint32_t micros;           // Building + serializing the document
+  };
+  // Heap check of /api/status (see recordStatusHeap)
+  enum HeapCheckState : uint8_t {
+    HEAP_WARMUP,               // First STATUS_HEAP_WARMUP requests are not measured
+    HEAP_MEASURING,
+    HEAP_PASS,
+    HEAP_FAIL
+  };
+  struct HeapCheck {
+    HeapCheckState state;
+    uint32_t measured;         // Requests measured after the warm-up
+    uint32_t allocations;      // malloc/calloc/realloc calls while measuring
+    uint32_t allocatingRequests;  // ... requests that made at least one
+    uint32_t fallbacks;        // Arena heap fallbacks while measuring
+  };
+  struct StatusStats {
+    uint32_t requests;
+    uint32_t overflows;        // Status did not fit STATUS_BUFFER_SIZE
+    uint32_t busyRejects;      // All buffers were still being sent
+    uint32_t deltas;           // Requests with ?since=
+    uint32_t notModified;      // ... answered with 304
+    FormatStats json;
+    FormatStats msgpack;
+    HeapCheck heap;
+  };
+  StatusStats statusStats;
+  
+  // Requests per route (exported by /metrics)
+  struct RouteStats {
+    const char* uri;
+    const char* method;
+    volatile uint32_t requests;
+  };
+  RouteStats routeStats[WEB_MAX_ROUTES];
+  int numRoutes;
+  volatile uint32_t notFoundRequests;
+  
+  typedef void (WebInterface::*RequestHandler)(AsyncWebServerRequest *request);
+  
+  // Register a route with a request counter
+  void route(const char* uri, WebRequestMethod method, RequestHandler handler) {
+    RouteStats* stats = nullptr;
+    if (numRoutes < WEB_MAX_ROUTES) {
+      stats = &routeStats[numRoutes++];
+      stats->uri = uri;
+      stats->method = (method == HTTP_POST) ? "POST" : "GET";
+      stats->requests = 0;
+    }
+    server.on(uri, method, [this, stats, handler](AsyncWebServerRequest *request) {
+      if (stats) stats->requests++;
+      (this->*handler)(request);
+    });
+  }
+  
+  typedef void (*BodyHandler)(AsyncWebServerRequest *request, uint8_t *data,
+                              size_t len, size_t index, size_t total);
+  
+  // Register a POST route that receives a request body
+  // onBody gets the body in chunks before the handler runs. The default
+  // collects up to WEB_MAX_BODY_SIZE NUL-terminated in request->_tempObject,
+  // which the server frees with the request; it stays nullptr when the body
+  // was missing or too large.
+  void routeBody(const char* uri, RequestHandler handler, BodyHandler onBody = &WebInterface::collectBody) {
+    RouteStats* stats = nullptr;
+    if (numRoutes < WEB_MAX_ROUTES) {
+      stats = &routeStats[numRoutes++];
+      stats->uri = uri;
+      stats->method = "POST";
+      stats->requests = 0;
+    }
+    server.on(uri, HTTP_POST,
+      [this, stats, handler](AsyncWebServerRequest *request) {
+        if (stats) stats->requests++;
+        (this->*handler)(request);
+      },
+      nullptr,
+      onBody);
+  }
+  
+  static void collectBody(AsyncWebServerRequest *request, uint8_t *data,
+                          size_t len, size_t index, size_t total);
+  static void receiveFirmware(AsyncWebServerRequest *request, uint8_t *data,
+                              size_t len, size_t index, size_t total);
+  
+  bool buildStatus(JsonDocument& doc, uint32_t sections = SECTION_ALL, uint32_t since = 0);
+  static bool parseStatusFields(const char* list, uint32_t& sections);
+  StatusBuffer* acquireStatusBuffer();
+  void sendStatusBuffer(AsyncWebServerRequest *request, StatusBuffer* buffer,
+                        size_t length, const char* contentType);
+  void recordStatusHeap(uint32_t allocations, uint32_t fallbacksBefore);
+  
+  // Deferred commands (executed by loop())
+  void postCommand(AsyncWebServerRequest *request, CommandQueue::Command& cmd);
+  void postCommand(AsyncWebServerRequest *request, CommandQueue::CommandType type);
   
   // API endpoints
   void handleRoot(AsyncWebServerRequest *request);
   void handleStatus(AsyncWebServerRequest *request);
   void handleUpdate(AsyncWebServerRequest *request);
+  void handleSettings(AsyncWebServerRequest *request);
   void handleDrop(AsyncWebServerRequest *request);
   void handleTogglePeltier(AsyncWebServerRequest *request);
   void handleTestPeltier(AsyncWebServerRequest *request);
@@ -27,10 +173,41 @@ private:
   void handleTestAudio(AsyncWebServerRequest *request);
   void handleReset(AsyncWebServerRequest *request);
   void handleToggleSystem(AsyncWebServerRequest *request);
+  void handleLatency(AsyncWebServerRequest *request);
+  void handleLatencyReset(AsyncWebServerRequest *request);
+  void handleStations(AsyncWebServerRequest *request);
+  void handleStationUpdate(AsyncWebServerRequest *request);
+  void handleStationDelete(AsyncWebServerRequest *request);
+  void handleCommandReply(AsyncWebServerRequest *request);
+  void handleHistory(AsyncWebServerRequest *request);
+  void handleMetrics(AsyncWebServerRequest *request);
+  void handleOta(AsyncWebServerRequest *request);
+  void handleOtaStatus(AsyncWebServerRequest *request);
   
 public:
-  WebInterface() : server(80), apMode(false), apSSID("DrippingMeteorite") {
+  WebInterface()
+    : server(80),
+      apMode(false),
+      apSSID("DrippingMeteorite"),
+      events("/api/events"),
+      hasLastPush(false),
+      lastPushTime(0),
+      pushId(0),
+      refreshPending(false),
+      numRoutes(0),
+      notFoundRequests(0) {
     apIP = IPAddress(192, 168, 4, 1);
+    memset(&statusStats, 0, sizeof(statusStats));
+  }
+  
+  // Push changed values to connected dashboards (call from loop())
+  // Drops and state transitions go out immediately, temperature changes at
+  // most every SSE_MIN_INTERVAL, and a heartbeat every SSE_HEARTBEAT_INTERVAL.
+  void pushUpdates();
+  
+  // Weather or settings changed - clients re-fetch the full status once
+  void notifyRefresh() {
+    refreshPending = true;
   }
   
   // Initialize web server with dual mode (AP + Station)
@@ -67,54 +244,67 @@ public:
   
   // Setup HTTP routes
   void setupRoutes() {
-    // Serve main HTML page
-    server.on("/", HTTP_GET, [this](AsyncWebServerRequest *request) {
-      request->send(200, "text/html", getHTML());
-    });
+    // Serve main HTML page (gzip, cached by the browser)
+    route("/", HTTP_GET, &WebInterface::handleRoot);
     
     // API endpoint for system status (JSON)
-    server.on("/api/status", HTTP_GET, [this](AsyncWebServerRequest *request) {
-      handleStatus(request);
-    });
+    route("/api/status", HTTP_GET, &WebInterface::handleStatus);
     
     // API endpoint to update parameters
-    server.on("/api/update", HTTP_POST, [this](AsyncWebServerRequest *request) {
-      handleUpdate(request);
-    });
+    route("/api/update", HTTP_POST, &WebInterface::handleUpdate);
+    
+    // API endpoint for batch settings updates (JSON body, all or nothing)
+    routeBody("/api/settings", &WebInterface::handleSettings);
     
     // API endpoint to trigger drop test
-    server.on("/api/drop", HTTP_POST, [this](AsyncWebServerRequest *request) {
-      handleDrop(request);
-    });
+    route("/api/drop", HTTP_POST, &WebInterface::handleDrop);
     
     // API endpoint to toggle Peltier on/off
-    server.on("/api/peltier/toggle", HTTP_POST, [this](AsyncWebServerRequest *request) {
-      handleTogglePeltier(request);
-    });
+    route("/api/peltier/toggle", HTTP_POST, &WebInterface::handleTogglePeltier);
     
     // API endpoints for manual testing
-    server.on("/api/test/peltier", HTTP_POST, [this](AsyncWebServerRequest *request) {
-      handleTestPeltier(request);
-    });
-    server.on("/api/test/led", HTTP_POST, [this](AsyncWebServerRequest *request) {
-      handleTestLED(request);
-    });
-    server.on("/api/test/audio", HTTP_POST, [this](AsyncWebServerRequest *request) {
-      handleTestAudio(request);
-    });
+    route("/api/test/peltier", HTTP_POST, &WebInterface::handleTestPeltier);
+    route("/api/test/led", HTTP_POST, &WebInterface::handleTestLED);
+    route("/api/test/audio", HTTP_POST, &WebInterface::handleTestAudio);
     
     // API endpoint to reset to defaults
-    server.on("/api/reset", HTTP_POST, [this](AsyncWebServerRequest *request) {
-      handleReset(request);
-    });
+    route("/api/reset", HTTP_POST, &WebInterface::handleReset);
     
     // API endpoint to toggle system RUN/PAUSE
-    server.on("/api/system/toggle", HTTP_POST, [this](AsyncWebServerRequest *request) {
-      handleToggleSystem(request);
+    route("/api/system/toggle", HTTP_POST, &WebInterface::handleToggleSystem);
+    
+    // API endpoint for the reply of a deferred command (?id=)
+    route("/api/command", HTTP_GET, &WebInterface::handleCommandReply);
+    
+    // Prometheus metrics (text exposition format)
+    route("/metrics", HTTP_GET, &WebInterface::handleMetrics);
+    
+    // API endpoints for drop-to-feedback latency histograms
+    route("/api/latency", HTTP_GET, &WebInterface::handleLatency);
+    route("/api/latency/reset", HTTP_POST, &WebInterface::handleLatencyReset);
+    
+    // API endpoint for recorded history (?from=&to= or ?range=, ?points=, ?format=csv|bin)
+    route("/api/history", HTTP_GET, &WebInterface::handleHistory);
+    
+    // Firmware update (raw image as the body) and its state
+    routeBody("/api/ota", &WebInterface::handleOta, &WebInterface::receiveFirmware);
+    route("/api/ota", HTTP_GET, &WebInterface::handleOtaStatus);
+    
+    // API endpoints for the runtime station registry
+    // (delete is registered first - "/api/stations" also matches its subpaths)
+    route("/api/stations/delete", HTTP_POST, &WebInterface::handleStationDelete);
+    route("/api/stations", HTTP_GET, &WebInterface::handleStations);
+    route("/api/stations", HTTP_POST, &WebInterface::handleStationUpdate);
+    
+    // Push channel for live dashboard updates (polling /api/status stays available)
+    events.onConnect([](AsyncEventSourceClient *client) {
+      client->send("{}", "refresh", 0, SSE_RECONNECT_DELAY);  // Client loads the full status once
     });
+    server.addHandler(&events);
     
     // Handle not found
-    server.onNotFound([](AsyncWebServerRequest *request) {
+    server.onNotFound([this](AsyncWebServerRequest *request) {
+      notFoundRequests++;
       request->send(404, "text/plain", "Not found");
     });
   }
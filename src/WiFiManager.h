@@ -4,17 +4,565 @@
 #include <M5Unified.h>
 #include <WiFi.h>
 #include <HTTPClient.h>
+#include <WiFiClientSecure.h>
 #include <ArduinoJson.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 #include "config.h"
 #include "WeatherStation.h"
+#include "WeatherCache.h"
+#include "StationRegistry.h"
+#include "HttpBodyStream.h"
 
 class WiFiManager {
+public:
+  // Connection state machine (driven by WiFi events + update())
+  enum ConnState {
+    STATE_IDLE,         // Disabled or not started
+    STATE_CONNECTING,   // WiFi.begin() issued, waiting for an IP
+    STATE_CONNECTED,
+    STATE_FAILED,       // Attempt failed or link lost - backoff is computed next
+    STATE_BACKOFF       // Waiting before the next attempt
+  };
+  
+  // Connection metrics (reported in /api/status)
+  struct ConnStats {
+    uint32_t attempts;
+    uint32_t successes;
+    uint32_t failures;
+    uint32_t disconnects;       // Link lost after being connected
+    uint32_t lastConnectMs;     // Time from WiFi.begin() to IP
+    uint32_t totalConnectMs;
+  };
+  
 private:
-  bool connected;
+  volatile bool connected;
   bool attempted;
   bool enabled;
   unsigned long lastAttemptTime;
-  unsigned long lastUpdateTime;
+  
+  volatile ConnState state;
+  volatile bool eventGotIP;     // Set from the WiFi event task
+  volatile bool eventLost;
+  bool eventsRegistered;
+  unsigned long backoffUntil;
+  uint32_t consecutiveFailures;
+  ConnStats connStats;
+  
+  // Background weather worker
+  // The worker keeps its own copy of the station registry (resynced when the
+  // registry version changes), fetches the referenced stations that are due
+  // and publishes their readings into one of two snapshot buffers. loop()
+  // copies the latest completed snapshot into the registry - it never waits
+  // on the network. Snapshot entries carry coordinates so they still land on
+  // the right station if the registry was edited in the meantime.
+  struct WeatherSnapshot {
+    float lat[WEATHER_MAX_STATIONS];
+    float lon[WEATHER_MAX_STATIONS];
+    float temperature[WEATHER_MAX_STATIONS];
+    float humidity[WEATHER_MAX_STATIONS];
+    float dewPoint[WEATHER_MAX_STATIONS];
+    unsigned long updatedAt[WEATHER_MAX_STATIONS];
+    uint32_t fetchedEpoch[WEATHER_MAX_STATIONS];
+    WeatherForecast forecast[WEATHER_MAX_STATIONS];
+    int count;
+  };
+  
+  TaskHandle_t weatherTask;
+  WeatherStation workStations[WEATHER_MAX_STATIONS];  // Worker-owned copy of the registry
+  unsigned long lastFetch[WEATHER_MAX_STATIONS];      // millis() of the last attempt (0 = never)
+  uint8_t fetchFailures[WEATHER_MAX_STATIONS];        // Consecutive failed attempts (retry backoff)
+  int workCount;
+  uint32_t workVersion;             // Registry version of workStations
+  WeatherStation batchStations[WEATHER_MAX_STATIONS]; // Due stations, contiguous for the batch request
+  int batchIndex[WEATHER_MAX_STATIONS];               // workStations index of each batch entry
+  volatile bool forceFetch;         // Fetch all referenced stations on the next wake
+  WeatherSnapshot snapshots[2];
+  volatile int publishedIndex;      // Buffer holding the latest snapshot (-1 = none)
+  volatile uint32_t publishedSeq;   // Incremented on every publish
+  uint32_t appliedSeq;              // Last sequence copied by loop()
+  WeatherSnapshot readCopy;         // loop()'s verified copy of the latest snapshot
+  
+  static const uint32_t WEATHER_TASK_STACK_SIZE = 12288;  // HTTPS + JSON
+  static const UBaseType_t WEATHER_TASK_PRIORITY = 1;
+  static const BaseType_t WEATHER_TASK_CORE = 0;  // loop() runs on core 1
+  static const uint32_t WEATHER_MIN_SLEEP = 1000;  // Floor for the next-due wait
+  
+  static bool sameLocation(float latA, float lonA, float latB, float lonB) {
+    return fabsf(latA - latB) < 0.001f && fabsf(lonA - lonB) < 0.001f;
+  }
+  
+  static void weatherTaskEntry(void* param) {
+    static_cast<WiFiManager*>(param)->weatherTaskLoop();
+  }
+  
+  // Worker body - resync, fetch due stations, publish, sleep until the next
+  // station is due or a request comes in
+  void weatherTaskLoop() {
+    while (true) {
+      syncStations();
+      uint32_t waitMs = WEATHER_UPDATE_INTERVAL;
+      if (connected && WiFi.status() == WL_CONNECTED) {
+        bool force = forceFetch;
+        forceFetch = false;
+        int due = collectDueStations(force);
+        if (due > 0) {
+          fetchWeather(batchStations, due);
+          for (int k = 0; k < due; k++) {
+            int i = batchIndex[k];
+            bool fetched = batchStations[k].updatedAt != workStations[i].updatedAt;
+            fetchFailures[i] = fetched ? 0 : (uint8_t)min(fetchFailures[i] + 1, 255);
+            workStations[i] = batchStations[k];
+          }
+          publishSnapshot();
+        }
+        waitMs = msUntilNextDue();
+      }
+      // Woken early by requestWeatherUpdate() and registry edits
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+    }
+  }
+  
+  // Copy the registry if it was edited - fetch times follow stations by location
+  void syncStations() {
+    if (stationRegistry.getVersion() == workVersion && workCount > 0) return;
+    
+    float oldLat[WEATHER_MAX_STATIONS];
+    float oldLon[WEATHER_MAX_STATIONS];
+    unsigned long oldFetch[WEATHER_MAX_STATIONS];
+    uint8_t oldFailures[WEATHER_MAX_STATIONS];
+    int oldCount = workCount;
+    for (int i = 0; i < oldCount; i++) {
+      oldLat[i] = workStations[i].lat;
+      oldLon[i] = workStations[i].lon;
+      oldFetch[i] = lastFetch[i];
+      oldFailures[i] = fetchFailures[i];
+    }
+    
+    workCount = stationRegistry.copyTo(workStations, workVersion);
+    for (int i = 0; i < workCount; i++) {
+      lastFetch[i] = 0;  // New or moved station - due now
+      fetchFailures[i] = 0;
+      for (int j = 0; j < oldCount; j++) {
+        if (sameLocation(oldLat[j], oldLon[j], workStations[i].lat, workStations[i].lon)) {
+          lastFetch[i] = oldFetch[j];
+          fetchFailures[i] = oldFailures[j];
+          break;
+        }
+      }
+    }
+  }
+  
+  // Should the worker fetch this station at all?
+  bool isReferenced(int index) const {
+    return index == stationRegistry.getLinkedIndex() ||
+           index == stationRegistry.getLocalIndex() ||
+           workStations[index].displayed;
+  }
+  
+  // Wait between attempts: the station's fetch interval after a success;
+  // after a failure WEATHER_RETRY_DELAY, doubling with every further failure
+  // up to the fetch interval
+  uint32_t attemptIntervalOf(int index) const {
+    uint32_t interval = StationRegistry::fetchIntervalOf(workStations[index]);
+    if (fetchFailures[index] == 0) return interval;
+    uint32_t retry = (uint32_t)WEATHER_RETRY_DELAY << min(fetchFailures[index] - 1, 8);
+    return min(retry, interval);
+  }
+  
+  bool isDue(int index, unsigned long now) const {
+    return lastFetch[index] == 0 || now - lastFetch[index] >= attemptIntervalOf(index);
+  }
+  
+  // Gather referenced, due stations into batchStations[] (highest priority first)
+  int collectDueStations(bool force) {
+    unsigned long now = millis();
+    int due = 0;
+    for (int i = 0; i < workCount; i++) {
+      if (!isReferenced(i) || !(force || isDue(i, now))) continue;
+      
+      // Insertion sort by priority (stable for equal priorities)
+      int pos = due;
+      while (pos > 0 && workStations[batchIndex[pos - 1]].priority < workStations[i].priority) {
+        batchIndex[pos] = batchIndex[pos - 1];
+        pos--;
+      }
+      batchIndex[pos] = i;
+      due++;
+      lastFetch[i] = now ? now : 1;
+    }
+    for (int k = 0; k < due; k++) {
+      batchStations[k] = workStations[batchIndex[k]];
+    }
+    return due;
+  }
+  
+  // Time until the next referenced station is due
+  uint32_t msUntilNextDue() const {
+    unsigned long now = millis();
+    uint32_t wait = WEATHER_UPDATE_INTERVAL;
+    for (int i = 0; i < workCount; i++) {
+      if (!isReferenced(i)) continue;
+      uint32_t interval = attemptIntervalOf(i);
+      unsigned long elapsed = now - lastFetch[i];
+      uint32_t remaining = (lastFetch[i] == 0 || elapsed >= interval) ? 0 : interval - elapsed;
+      wait = min(wait, remaining);
+    }
+    return max(wait, (uint32_t)WEATHER_MIN_SLEEP);
+  }
+  
+  // Write every station fetched this boot into the buffer loop() is not reading
+  // loop() only applies entries whose fetch time differs from what it has, so
+  // readings interpolated since then are not overwritten by older values.
+  void publishSnapshot() {
+    int target = (publishedIndex == 0) ? 1 : 0;
+    WeatherSnapshot& snap = snapshots[target];
+    int count = 0;
+    for (int i = 0; i < workCount; i++) {
+      const WeatherStation& s = workStations[i];
+      if (s.updatedAt == 0) continue;
+      snap.lat[count] = s.lat;
+      snap.lon[count] = s.lon;
+      snap.temperature[count] = s.temperature;
+      snap.humidity[count] = s.humidity;
+      snap.dewPoint[count] = s.dewPoint;
+      snap.updatedAt[count] = s.updatedAt;
+      snap.fetchedEpoch[count] = s.fetchedEpoch;
+      snap.forecast[count] = s.forecast;
+      count++;
+    }
+    snap.count = count;
+    
+    __atomic_store_n(&publishedIndex, target, __ATOMIC_RELEASE);
+    __atomic_add_fetch(&publishedSeq, 1, __ATOMIC_RELEASE);
+  }
+  
+  // Persistent client for the weather API (weather task only)
+  // The connection is kept alive between requests; the API host address
+  // is cached for WEATHER_DNS_TTL so reconnects skip the DNS lookup.
+  // The base URL (WEATHER_API_BASE_URL) may point at plain http - e.g. the
+  // local mock server in tools/ - in which case plainClient is used.
+  WiFiClientSecure secureClient;
+  WiFiClient plainClient;
+  bool apiSecure;
+  String apiHost;
+  uint16_t apiPort;
+  String apiPathPrefix;          // Prepended to /v1/forecast (no trailing slash)
+  IPAddress apiIP;
+  bool apiIPValid;
+  unsigned long apiIPResolvedAt;
+  
+  WiFiClient& apiClient() {
+    return apiSecure ? secureClient : plainClient;
+  }
+  
+public:
+  // Weather HTTP client statistics (reported in /api/status)
+  struct HttpStats {
+    uint32_t requests;
+    uint32_t reusedRequests;     // Sent on an already open connection
+    uint32_t handshakes;         // New connections (TLS handshakes for https)
+    uint32_t handshakeTimeMs;    // Total time spent connecting
+    uint32_t lastHandshakeMs;
+    uint32_t dnsLookups;
+    uint32_t dnsCacheHits;
+    uint32_t bytesReceived;      // Response payload bytes
+    uint32_t chunkedResponses;   // Bodies sent with Transfer-Encoding: chunked
+    uint32_t closedAfterResponse; // Body read completely, but the connection was not kept
+    uint32_t errors;
+    uint32_t fetches;            // fetchWeather() rounds (batch or per station)
+    uint32_t fetchTimeMs;        // Total time spent in them
+    uint32_t lastFetchMs;
+  };
+  
+private:
+  HttpStats httpStats;
+  bool bodyRead;                 // Body of the current response read to its end
+  
+  // Resolve the API host, reusing the cached address within its TTL
+  bool resolveApiHost(IPAddress& ip) {
+    if (apiIPValid && millis() - apiIPResolvedAt < WEATHER_DNS_TTL) {
+      httpStats.dnsCacheHits++;
+      ip = apiIP;
+      return true;
+    }
+    
+    if (apiIP.fromString(apiHost)) {  // Literal address - nothing to resolve
+      apiIPValid = true;
+      apiIPResolvedAt = millis();
+      ip = apiIP;
+      return true;
+    }
+    
+    httpStats.dnsLookups++;
+    if (WiFi.hostByName(apiHost.c_str(), apiIP) != 1) {
+      apiIPValid = false;
+      return false;
+    }
+    apiIPValid = true;
+    apiIPResolvedAt = millis();
+    ip = apiIP;
+    return true;
+  }
+  
+  // Make sure the API connection is open - reuse it if it still is
+  // Returns false if the connection could not be established
+  bool ensureConnected(bool& reused) {
+    reused = apiClient().connected();
+    if (reused) {
+      return true;
+    }
+    
+    IPAddress ip;
+    if (!resolveApiHost(ip)) {
+      return false;
+    }
+    
+    unsigned long start = millis();
+    apiClient().stop();
+    bool ok = apiSecure
+      ? secureClient.connect(ip, apiPort, apiHost.c_str(), nullptr, nullptr, nullptr)
+      : plainClient.connect(ip, apiPort);
+    if (!ok) {
+      apiIPValid = false;  // Address may have changed - resolve again next time
+      return false;
+    }
+    httpStats.lastHandshakeMs = millis() - start;
+    httpStats.handshakeTimeMs += httpStats.lastHandshakeMs;
+    httpStats.handshakes++;
+    return true;
+  }
+  
+  // Send a GET for path on the persistent connection
+  // A reused connection the server already closed is retried once fresh.
+  int beginGet(HTTPClient& http, const String& path) {
+    for (int attempt = 0; attempt < 2; attempt++) {
+      httpStats.requests++;
+      bool reused = false;
+      if (!ensureConnected(reused)) {
+        httpStats.errors++;
+        return HTTPC_ERROR_CONNECTION_REFUSED;
+      }
+      if (reused) httpStats.reusedRequests++;
+      
+      static const char* headerKeys[] = {"Transfer-Encoding"};
+      http.setReuse(true);  // HTTP/1.1 keep-alive - parseCurrent() stops at the end of the body
+      http.begin(apiClient(), apiHost, apiPort, apiPathPrefix + path, apiSecure);
+      http.collectHeaders(headerKeys, 1);
+      bodyRead = false;
+      int httpCode = http.GET();
+      if (httpCode > 0) {
+        if (httpCode != HTTP_CODE_OK) httpStats.errors++;
+        return httpCode;
+      }
+      
+      httpStats.errors++;
+      http.end();
+      apiClient().stop();
+      if (!reused) return httpCode;  // Fresh connection failed - don't retry
+    }
+    return HTTPC_ERROR_CONNECTION_LOST;
+  }
+  
+  // WiFi event callbacks run on the WiFi task - only set flags here
+  void registerEvents() {
+    if (eventsRegistered) return;
+    eventsRegistered = true;
+    WiFi.setAutoReconnect(false);  // Retries are handled by the state machine
+    WiFi.onEvent([this](WiFiEvent_t event, WiFiEventInfo_t info) {
+      eventGotIP = true;
+    }, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent([this](WiFiEvent_t event, WiFiEventInfo_t info) {
+      eventLost = true;
+    }, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+  }
+  
+  void startAttempt() {
+    lastAttemptTime = millis();
+    attempted = true;
+    connStats.attempts++;
+    state = STATE_CONNECTING;
+    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+  }
+  
+  void onConnected() {
+    connected = true;
+    state = STATE_CONNECTED;
+    consecutiveFailures = 0;
+    connStats.successes++;
+    connStats.lastConnectMs = millis() - lastAttemptTime;
+    connStats.totalConnectMs += connStats.lastConnectMs;
+    Serial.printf("WiFi connected in %lu ms, IP: %s\n", (unsigned long)connStats.lastConnectMs,
+                  WiFi.localIP().toString().c_str());
+    
+    configTime(0, 0, NTP_SERVER);  // Wall clock for persisted weather timestamps
+    requestWeatherUpdate();        // Fresh data right after (re)connecting
+  }
+  
+  // Copy the "current" block of an Open-Meteo response into a station
+  static bool applyCurrent(JsonVariantConst current, WeatherStation& station) {
+    if (current.isNull()) return false;
+    station.temperature = current["temperature_2m"];
+    station.humidity = current["relative_humidity_2m"];
+    station.dewPoint = current["dew_point_2m"];
+    station.updatedAt = millis();
+    station.fetchedEpoch = WeatherCache::nowEpoch();
+    return true;
+  }
+  
+  // Copy the "hourly" block (unixtime + temperature_2m) into the forecast
+  static void applyHourly(JsonVariantConst hourly, WeatherStation& station) {
+    JsonArrayConst times = hourly["time"];
+    JsonArrayConst temps = hourly["temperature_2m"];
+    if (times.isNull() || temps.isNull() || times.size() == 0) return;
+    
+    WeatherForecast& f = station.forecast;
+    f.startEpoch = times[0];
+    f.hours = 0;
+    for (JsonVariantConst t : temps) {
+      if (f.hours >= WEATHER_FORECAST_HOURS || t.isNull()) break;
+      f.tenths[f.hours++] = (int16_t)lroundf(t.as<float>() * 10.0f);
+    }
+  }
+  
+  // Parse the response straight from the HTTP stream through a filter, so
+  // only current.temperature_2m / relative_humidity_2m / dew_point_2m and
+  // the hourly temperature forecast are materialised (no payload String,
+  // no full JSON tree)
+  DeserializationError parseCurrent(HTTPClient& http, JsonDocument& doc, bool isArray) {
+    JsonDocument filter;
+    JsonObject fields = isArray ? filter.add<JsonObject>() : filter.to<JsonObject>();
+    JsonObject current = fields["current"].to<JsonObject>();
+    current["temperature_2m"] = true;
+    current["relative_humidity_2m"] = true;
+    current["dew_point_2m"] = true;
+    JsonObject hourly = fields["hourly"].to<JsonObject>();
+    hourly["time"] = true;
+    hourly["temperature_2m"] = true;
+    
+    HttpBodyStream body(http.getStream(), isChunked(http), http.getSize(), WEATHER_HTTP_TIMEOUT);
+    DeserializationError error = deserializeJson(doc, body, DeserializationOption::Filter(filter));
+    if (!finishBody(body) && !error) error = DeserializationError::IncompleteInput;
+    return error;
+  }
+  
+  static bool isChunked(HTTPClient& http) {
+    return http.header("Transfer-Encoding").equalsIgnoreCase("chunked");
+  }
+  
+  // Read the rest of a response body so the connection can carry the next
+  // request. A body that did not end cleanly leaves the connection in an
+  // unknown state - it is closed instead.
+  bool finishBody(HttpBodyStream& body) {
+    bodyRead = body.drain();
+    if (!bodyRead) apiClient().stop();
+    httpStats.bytesReceived += body.getReceived();
+    return bodyRead;
+  }
+  
+  // End a request started with beginGet()
+  // The connection stays open for the next request. If the server closed it
+  // although the body was read completely, keep-alive is not working (every
+  // request pays a new handshake) - counted in closedAfterResponse.
+  void endGet(HTTPClient& http, int httpCode) {
+    if (httpCode > 0 && !bodyRead && apiClient().connected()) {
+      // Error responses are skipped, not parsed
+      HttpBodyStream body(http.getStream(), isChunked(http), http.getSize(), WEATHER_HTTP_TIMEOUT);
+      finishBody(body);
+    }
+    if (httpCode > 0 && isChunked(http)) httpStats.chunkedResponses++;
+    http.end();
+    if (bodyRead && !apiClient().connected()) httpStats.closedAfterResponse++;
+  }
+  
+  // One request for all stations: comma-separated coordinates, the API
+  // answers with a JSON array in the same order
+  bool fetchWeatherBatch(WeatherStation* stations, int numStations) {
+    if (numStations <= 0) return true;
+    
+    String lat, lon, tz;
+    for (int i = 0; i < numStations; i++) {
+      if (i > 0) {
+        lat += ',';
+        lon += ',';
+        tz += ',';
+      }
+      lat += String(stations[i].lat, 4);
+      lon += String(stations[i].lon, 4);
+      tz += stations[i].timezone;
+    }
+    
+    String path = "/v1/forecast?latitude=";
+    path += lat;
+    path += "&longitude=";
+    path += lon;
+    path += "&current=temperature_2m,relative_humidity_2m,dew_point_2m";
+    path += "&hourly=temperature_2m&forecast_hours=" + String(WEATHER_FORECAST_HOURS);
+    path += "&timeformat=unixtime&timezone=";
+    path += tz;
+    
+    HTTPClient http;
+    int httpCode = beginGet(http, path);
+    bool ok = false;
+    
+    if (httpCode == HTTP_CODE_OK) {
+      JsonDocument doc;
+      DeserializationError error = parseCurrent(http, doc, numStations > 1);
+      
+      if (!error) {
+        if (numStations == 1 && doc.is<JsonObject>()) {
+          // Single location - API returns a plain object
+          ok = applyCurrent(doc["current"], stations[0]);
+          applyHourly(doc["hourly"], stations[0]);
+        } else if (doc.is<JsonArray>() && (int)doc.size() == numStations) {
+          // Validate every entry before touching any station
+          ok = true;
+          for (int i = 0; i < numStations; i++) {
+            if (doc[i]["current"].isNull()) {
+              ok = false;
+              break;
+            }
+          }
+          if (ok) {
+            for (int i = 0; i < numStations; i++) {
+              applyCurrent(doc[i]["current"], stations[i]);
+              applyHourly(doc[i]["hourly"], stations[i]);
+            }
+          }
+        }
+      }
+    }
+    endGet(http, httpCode);
+    return ok;
+  }
+  
+  // Fallback: one request for a single station
+  bool fetchWeatherStation(WeatherStation& station) {
+    String path = "/v1/forecast?latitude=";
+    path += String(station.lat, 4);
+    path += "&longitude=";
+    path += String(station.lon, 4);
+    path += "&current=temperature_2m,relative_humidity_2m,dew_point_2m";
+    path += "&hourly=temperature_2m&forecast_hours=" + String(WEATHER_FORECAST_HOURS);
+    path += "&timeformat=unixtime&timezone=";
+    path += station.timezone;
+    
+    HTTPClient http;
+    int httpCode = beginGet(http, path);
+    bool ok = false;
+    
+    if (httpCode == HTTP_CODE_OK) {
+      JsonDocument doc;
+      DeserializationError error = parseCurrent(http, doc, false);
+      
+      if (!error) {
+        ok = applyCurrent(doc["current"], station);
+        applyHourly(doc["hourly"], station);
+      }
+    }
+    endGet(http, httpCode);
+    return ok;
+  }
   
 public:
   WiFiManager() 
@@ -22,120 +570,280 @@ public:
       attempted(false),
       enabled(WIFI_ENABLED),
       lastAttemptTime(0),
-      lastUpdateTime(0) {
+      state(STATE_IDLE),
+      eventGotIP(false),
+      eventLost(false),
+      eventsRegistered(false),
+      backoffUntil(0),
+      consecutiveFailures(0),
+      weatherTask(nullptr),
+      workCount(0),
+      workVersion(0),
+      forceFetch(false),
+      publishedIndex(-1),
+      publishedSeq(0),
+      appliedSeq(0),
+      apiSecure(true),
+      apiPort(443),
+      apiIPValid(false),
+      apiIPResolvedAt(0),
+      bodyRead(false) {
+    memset(&httpStats, 0, sizeof(httpStats));
+    memset(&connStats, 0, sizeof(connStats));
+    memset(lastFetch, 0, sizeof(lastFetch));
+    memset(fetchFailures, 0, sizeof(fetchFailures));
+    secureClient.setInsecure();  // Same as before: no certificate pinning
+    setWeatherBaseUrl(WEATHER_API_BASE_URL);
+  }
+  
+  // Point the weather client at another API server, e.g. "http://192.168.1.20:8080"
+  // for the mock server. Call before startWeatherTask(). Returns false (and
+  // keeps the current URL) if the URL is not http(s)://host[:port][/prefix].
+  bool setWeatherBaseUrl(const char* url) {
+    String u = url;
+    bool secure;
+    if (u.startsWith("https://")) {
+      secure = true;
+      u.remove(0, 8);
+    } else if (u.startsWith("http://")) {
+      secure = false;
+      u.remove(0, 7);
+    } else {
+      return false;
+    }
+    
+    String prefix;
+    int slash = u.indexOf('/');
+    if (slash >= 0) {
+      prefix = u.substring(slash);
+      u.remove(slash);
+      while (prefix.endsWith("/")) prefix.remove(prefix.length() - 1);
+    }
+    
+    uint16_t port = secure ? 443 : 80;
+    int colon = u.indexOf(':');
+    if (colon >= 0) {
+      long p = u.substring(colon + 1).toInt();
+      if (p <= 0 || p > 65535) return false;
+      port = (uint16_t)p;
+      u.remove(colon);
+    }
+    if (u.length() == 0) return false;
+    
+    plainClient.stop();
+    secureClient.stop();
+    apiSecure = secure;
+    apiHost = u;
+    apiPort = port;
+    apiPathPrefix = prefix;
+    apiIPValid = false;
+    return true;
   }
   
   // Initialize WiFi (does not connect yet)
   void begin() {
     WiFi.mode(WIFI_STA);
+    registerEvents();
   }
   
-  // Attempt to connect to WiFi
+  // Start connecting to WiFi (non-blocking)
+  // Progress is driven by WiFi events and update(). Returns true if
+  // already connected.
   bool connect() {
+    registerEvents();
     if (connected) {
       return true; // Already connected
     }
+    if (state == STATE_IDLE || state == STATE_BACKOFF) {
+      startAttempt();
+    }
+    return false;
+  }
+  
+  // Advance the connection state machine - call from loop()
+  void update() {
+    registerEvents();
     
-    lastAttemptTime = millis();
-    
-    M5.Display.fillScreen(BLACK);
-    M5.Display.setCursor(10, 10);
-    M5.Display.println("Connecting...");
-    
-    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
-    int attempts = 0;
-    while (WiFi.status() != WL_CONNECTED && attempts < 2) {
-      delay(500);
-      M5.Display.print(".");
-      attempts++;
+    // Events from the WiFi task
+    if (eventGotIP) {
+      eventGotIP = false;
+      if (state != STATE_CONNECTED) {
+        onConnected();
+      }
+    }
+    if (eventLost) {
+      eventLost = false;
+      // While connecting, disconnect events also come from WiFi.begin()
+      // resetting the link - failed attempts are caught by the timeout
+      if (state == STATE_CONNECTED) {
+        connStats.disconnects++;
+        connected = false;
+        state = STATE_FAILED;
+      }
     }
     
-    attempted = true;
-    M5.Display.fillScreen(BLACK);
-    
-    if (WiFi.status() == WL_CONNECTED) {
-      connected = true;
-      M5.Display.setCursor(10, 10);
-      M5.Display.println("WiFi Connected!");
-      M5.Display.setCursor(10, 30);
-      M5.Display.print("IP: ");
-      M5.Display.println(WiFi.localIP());
-      delay(2000);
-      return true;
-    } else {
-      connected = false;
-      M5.Display.setCursor(10, 10);
-      M5.Display.println("WiFi Failed!");
-      M5.Display.setCursor(10, 30);
-      M5.Display.println("Using presets");
-      M5.Display.setCursor(10, 50);
-      M5.Display.println("Press screen");
-      M5.Display.setCursor(10, 65);
-      M5.Display.println("to retry");
-      delay(2000);
-      return false;
+    switch (state) {
+      case STATE_IDLE:
+        if (enabled) startAttempt();  // Enabled (e.g. from the web interface)
+        break;
+        
+      case STATE_CONNECTING:
+        if (millis() - lastAttemptTime > WIFI_CONNECT_TIMEOUT) {
+          state = STATE_FAILED;
+        }
+        break;
+        
+      case STATE_CONNECTED:
+        break;
+        
+      case STATE_FAILED: {
+        connected = false;
+        connStats.failures++;
+        consecutiveFailures++;
+        WiFi.disconnect();
+        
+        // Exponential backoff with jitter (avoids retry storms)
+        unsigned long delayMs = WIFI_BACKOFF_MIN;
+        for (uint32_t i = 1; i < consecutiveFailures && delayMs < WIFI_RETRY_INTERVAL; i++) {
+          delayMs *= 2;
+        }
+        if (delayMs > WIFI_RETRY_INTERVAL) delayMs = WIFI_RETRY_INTERVAL;
+        delayMs += random(0, delayMs / 4 + 1);
+        
+        backoffUntil = millis() + delayMs;
+        state = STATE_BACKOFF;
+        Serial.printf("WiFi: attempt failed, retrying in %lu ms\n", delayMs);
+        break;
+      }
+        
+      case STATE_BACKOFF:
+        if (enabled && (long)(millis() - backoffUntil) >= 0) {
+          startAttempt();
+        }
+        break;
     }
   }
   
-  // Fetch weather data for all stations
+  // Fetch weather data for all stations (blocking - runs on the weather task)
+  // Tries one batched multi-location request first (single TLS handshake),
+  // falls back to one request per station if that fails
   void fetchWeather(WeatherStation* stations, int numStations) {
     if (!connected || WiFi.status() != WL_CONNECTED) {
       return;  // Silently skip if no WiFi
     }
     
-    HTTPClient http;
+    unsigned long start = millis();
+    if (!fetchWeatherBatch(stations, numStations)) {
+      Serial.println("Batched weather request failed - fetching per station");
+      for (int i = 0; i < numStations; i++) {
+        fetchWeatherStation(stations[i]);
+      }
+    }
     
-    M5.Display.fillScreen(BLACK);
-    M5.Display.setCursor(10, 10);
-    M5.Display.println("Fetching data...");
+    httpStats.lastFetchMs = millis() - start;
+    httpStats.fetchTimeMs += httpStats.lastFetchMs;
+    httpStats.fetches++;
+  }
+  
+  // Start the background weather task (fetches immediately if connected)
+  // Stations come from stationRegistry - the worker resyncs after edits.
+  bool startWeatherTask() {
+    if (weatherTask != nullptr) return true;
     
-    // Fetch data for all weather stations
-    for (int i = 0; i < numStations; i++) {
-      String url = "https://api.open-meteo.com/v1/forecast?latitude=";
-      url += String(stations[i].lat, 4);
-      url += "&longitude=";
-      url += String(stations[i].lon, 4);
-      url += "&current=temperature_2m,relative_humidity_2m,dew_point_2m&timezone=";
-      url += stations[i].timezone;
-      
-      http.begin(url);
-      int httpCode = http.GET();
+    return xTaskCreatePinnedToCore(weatherTaskEntry, "weather", WEATHER_TASK_STACK_SIZE, this,
+                                   WEATHER_TASK_PRIORITY, &weatherTask, WEATHER_TASK_CORE) == pdPASS;
+  }
+  
+  // Wake the weather task (non-blocking, safe from any task)
+  // force = fetch every referenced station now, otherwise only the due ones
+  // (e.g. after a registry edit added a station).
+  void requestWeatherUpdate(bool force = true) {
+    if (force) forceFetch = true;
+    if (weatherTask != nullptr) {
+      xTaskNotifyGive(weatherTask);
+    }
+  }
+  
+  // Copy the latest completed snapshot into the station table
+  // The snapshot is first copied into readCopy and only used once
+  // publishedSeq shows no publish completed meanwhile (the worker could
+  // otherwise reuse the buffer mid-copy), so the table never sees torn
+  // values. Entries are matched by coordinates; only newer fetches are
+  // applied. Call from loop() only. Returns the number of new readings
+  // applied (0 if nothing was published since the last call, or the round
+  // brought no successful fetch).
+  int applyLatestWeather(WeatherStation* stations, int numStations) {
+    uint32_t seq = __atomic_load_n(&publishedSeq, __ATOMIC_ACQUIRE);
+    if (seq == appliedSeq) return 0;
+    
+    // Retry if the worker published again while we were copying
+    while (true) {
+      int index = __atomic_load_n(&publishedIndex, __ATOMIC_ACQUIRE);
+      if (index < 0) return 0;
       
-      if (httpCode == HTTP_CODE_OK) {
-        String payload = http.getString();
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, payload);
-        
-        if (!error) {
-          stations[i].temperature = doc["current"]["temperature_2m"];
-          stations[i].humidity = doc["current"]["relative_humidity_2m"];
-          stations[i].dewPoint = doc["current"]["dew_point_2m"];
+      memcpy(&readCopy, &snapshots[index], sizeof(readCopy));
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);  // Copy done before the recheck
+      uint32_t after = __atomic_load_n(&publishedSeq, __ATOMIC_ACQUIRE);
+      if (after == seq) break;
+      seq = after;
+    }
+    appliedSeq = seq;
+    
+    int applied = 0;
+    const WeatherSnapshot& snap = readCopy;
+    for (int k = 0; k < snap.count; k++) {
+      for (int i = 0; i < numStations; i++) {
+        WeatherStation& s = stations[i];
+        if (!sameLocation(snap.lat[k], snap.lon[k], s.lat, s.lon)) continue;
+        if (s.updatedAt != snap.updatedAt[k]) {
+          s.temperature = snap.temperature[k];
+          s.humidity = snap.humidity[k];
+          s.dewPoint = snap.dewPoint[k];
+          s.updatedAt = snap.updatedAt[k];
+          s.fetchedEpoch = snap.fetchedEpoch[k];
+          s.forecast = snap.forecast[k];
+          applied++;
         }
       }
-      http.end();
     }
-    
-    lastUpdateTime = millis();
+    return applied;
   }
   
-  // Check if periodic update is needed
-  bool shouldUpdate() {
-    return connected && (millis() - lastUpdateTime > WEATHER_UPDATE_INTERVAL);
+  // Weather HTTP client statistics
+  const HttpStats& getHttpStats() const {
+    return httpStats;
   }
   
-  // Check if periodic retry is needed
-  bool shouldRetry() {
-    return enabled && !connected && (millis() - lastAttemptTime > WIFI_RETRY_INTERVAL);
-  }
+  // Weather API server in use (differs from the default when mocked)
+  const char* getWeatherHost() const { return apiHost.c_str(); }
+  uint16_t getWeatherPort() const { return apiPort; }
   
   // Getters
   bool isConnected() const { return connected; }
+  ConnState getState() const { return state; }
+  const ConnStats& getConnStats() const { return connStats; }
+  
+  const char* getStateName() const {
+    switch (state) {
+      case STATE_IDLE:       return "idle";
+      case STATE_CONNECTING: return "connecting";
+      case STATE_CONNECTED:  return "connected";
+      case STATE_FAILED:     return "failed";
+      case STATE_BACKOFF:    return "backoff";
+      default:               return "?";
+    }
+  }
   bool isEnabled() const { return enabled; }
   bool wasAttempted() const { return attempted; }
   
   // Enable/disable WiFi
   void enable() { enabled = true; }
-  void disable() { enabled = false; }
+  void disable() {
+    enabled = false;
+    connected = false;
+    state = STATE_IDLE;
+    WiFi.disconnect();
+  }
 };
 
 // Global instance
@@ -33,11 +33,37 @@
 #define WIFI_SSID       "AndroidAPda3a"
 #define WIFI_PASSWORD   "aobi9897"
 #define WIFI_ENABLED    false  // Set to false to run without WiFi (uses preset values)
-#define WIFI_RETRY_INTERVAL 60000  // Retry WiFi connection every 60 seconds if failed
+#define WIFI_RETRY_INTERVAL 60000  // Maximum delay between WiFi connection attempts (backoff ceiling)
+#define WIFI_BACKOFF_MIN 2000      // milliseconds - First retry delay, doubled after each failure (plus jitter)
+#define WIFI_CONNECT_TIMEOUT 15000 // milliseconds - Give up on a connection attempt after this
 
 // Web Server settings
 #define WEBSERVER_ENABLED true           // Enable web interface
 #define WEBSERVER_AP_PASSWORD "meteorite123"  // Access Point password (min 8 chars)
+#define SSE_MIN_INTERVAL 500             // milliseconds - Minimum spacing of pushed temperature updates (drops/state changes go out immediately)
+#define SSE_HEARTBEAT_INTERVAL 15000     // milliseconds - Status is re-pushed at least this often (lets clients detect a dead link)
+#define SSE_RECONNECT_DELAY 3000         // milliseconds - Browser retry delay after the event stream drops
+#define STATUS_ARENA_SIZE 8192           // bytes - Fixed memory for the /api/status JSON document
+#define STATUS_BUFFER_SIZE 4096          // bytes - One serialized /api/status response
+#define STATUS_BUFFER_SLOTS 2            // Responses that can be in flight at once
+#define STATUS_HEAP_WARMUP 20            // /api/status requests before the heap check starts (first-use allocations)
+#define STATUS_HEAP_CHECK_REQUESTS 200   // Requests measured by the heap check before it passes or fails
+#define COMMAND_QUEUE_LENGTH 8           // Web commands waiting for loop() (further posts get 503)
+#define COMMAND_REPLY_SLOTS 8            // Recent command replies kept for /api/command?id=
+#define COMMAND_REPLY_SIZE 384           // bytes - JSON reply of one command (per-field results of /api/settings)
+#define COMMAND_REPLY_TIMEOUT 2000       // milliseconds - Deferred response gives up and returns the reply ID
+#define RESTART_DELAY 1500               // milliseconds - Restart after /api/reset (reply is sent first)
+#define METRICS_BUFFER_SIZE 12288        // bytes - One /metrics response (Prometheus text format)
+#define WEB_MAX_ROUTES 32                // Routes with their own request counter in /metrics
+#define WEB_MAX_BODY_SIZE 1024           // bytes - Largest JSON request body (/api/settings; larger gets 413)
+
+// Firmware update over HTTP (/api/ota) - rollback if the new firmware is unhealthy
+#define OTA_HEALTH_TIMEOUT 120000        // milliseconds - New firmware must pass its health checks within this time
+#define OTA_HEALTH_LOOPS 1000            // loop() iterations the new firmware must complete
+#define OTA_MAX_TRIAL_BOOTS 3            // Reboots of unverified firmware before rolling back (crash loop)
+#ifndef OTA_SECRET
+#define OTA_SECRET ""                    // Key for the X-Firmware-Signature HMAC (empty = uploads refused) - set with -DOTA_SECRET=\"...\"
+#endif
 
 // Thermostat settings
 #define THERMOSTAT_HYSTERESIS 0.5  // °C (deprecated - using REACTIVATE_TEMP instead)
@@ -46,6 +72,19 @@
 #define DURATION_GLACIER_FREEZING 10000 // 900000  // milliseconds - Keep cooling after reaching glacier temp. For instance, 5 minutes = 300000 ms. For more ice, we can keep it longer, for instance 15 minutes = 900000 ms.
 #define REACTIVATE_TIMER 900000     // milliseconds - Auto-restart cooling after this time. Example: 30 minutes is 1800000 ms. 15 min is 900000 ms.
 
+// Accepted ranges for settings changed over the web (/api/settings)
+#define SETTING_TEMP_MIN -20.0               // °C - manualSetpoint and reactivateTemp
+#define SETTING_TEMP_MAX 40.0                // °C
+#define SETTING_FREEZE_DURATION_MIN 1000     // milliseconds
+#define SETTING_FREEZE_DURATION_MAX 3600000  // milliseconds - 1 hour
+#define SETTING_REACTIVATE_TIMER_MIN 60000   // milliseconds - 1 minute
+#define SETTING_REACTIVATE_TIMER_MAX 86400000 // milliseconds - 24 hours
+#define SETTING_LED_FADE_TIME_MAX 60000      // milliseconds
+
+// Settings persistence (NVS) - changes are saved once they stop coming in
+#define SETTINGS_SAVE_DELAY 2000             // milliseconds - Quiet period before a change is written
+#define SETTINGS_SAVE_MAX_DELAY 10000        // milliseconds - Longest a change waits during continuous edits
+
 // Drop detector settings
 #define DROP_DEBOUNCE_MS 50       // milliseconds
 #define DROP_TRIGGER_MODE FALLING  // RISING, FALLING, or CHANGE
@@ -66,8 +105,38 @@
 #define AUDIO_PLAYER_BAUD_RATE 9600  // Serial baud rate for audio module
 #define AUDIO_PLAYER_VOLUME 30       // Default volume (value range: 0-30)
 #define DROP_SOUND_TRACK 1           // Track number for drop sound effect
+#define AUDIO_QUEUE_LENGTH 8         // Pending commands for the audio task (oldest dropped when full)
+#define AUDIO_COMMAND_TIMEOUT 500    // milliseconds - Commands older than this are discarded (stale sound)
+#define AUDIO_COMMAND_RETRIES 2      // Extra attempts when the module reports an error
+#define AUDIO_STATUS_POLL_INTERVAL 1000  // milliseconds - How often the audio task refreshes the cached play status
+
+// LCD temperature graph
+#define GRAPH_SAMPLE_INTERVAL 10000  // milliseconds - One graph column per sample (128 columns = ~21 minutes)
+
+// History log (LittleFS, served by /api/history)
+#define HISTORY_SAMPLE_INTERVAL 60000   // milliseconds - One averaged record per interval
+#define HISTORY_FLUSH_RECORDS 10        // Records buffered in RAM before one flash append (max 32)
+#define HISTORY_SEGMENT_RECORDS 1440    // Records per segment file (one day at one per minute)
+#define HISTORY_MAX_SEGMENTS 42         // Oldest segment is deleted beyond this (6 weeks, ~600 KB)
+#define HISTORY_MAX_POINTS 10000        // Upper bound for ?points= on /api/history
+#define HISTORY_MAX_STREAMS 2           // Concurrent /api/history responses (503 beyond)
+#define HISTORY_READ_BUDGET 8192        // Records scanned per response chunk before yielding to other clients
 
 // Weather update interval
-#define WEATHER_UPDATE_INTERVAL 300000  // 5 minutes in milliseconds
+#define WEATHER_UPDATE_INTERVAL 10800000  // 3 hours in milliseconds (hourly forecast is interpolated in between)
+#define WEATHER_FORECAST_HOURS 48       // Hourly forecast values kept per station
+#define FORECAST_INTERPOLATE_INTERVAL 60000  // milliseconds - How often station temperatures are re-interpolated
+#define WEATHER_MAX_STATIONS 8          // Capacity of the station registry
+#define WEATHER_STATION_NAME_LEN 24     // Station name buffer (including terminator)
+#define WEATHER_STATION_TZ_LEN 40       // IANA timezone buffer (including terminator)
+#define WEATHER_MIN_FETCH_INTERVAL 900000  // milliseconds - Shortest per-station fetch interval accepted by /api/stations (15 min)
+#ifndef WEATHER_API_BASE_URL
+#define WEATHER_API_BASE_URL "https://api.open-meteo.com"  // http(s)://host[:port][/prefix] - override with -DWEATHER_API_BASE_URL for tools/mock_open_meteo.py
+#endif
+#define WEATHER_DNS_TTL 3600000         // milliseconds - How long the resolved API address is reused (1 hour)
+#define WEATHER_HTTP_TIMEOUT 5000       // milliseconds - Longest wait for the next byte of a response body
+#define WEATHER_RETRY_DELAY 60000       // milliseconds - First retry after a failed fetch (doubles per failure, up to the fetch interval)
+#define WEATHER_STALE_AGE 21600000      // milliseconds - Without a forecast covering now, readings older than this (or of unknown age) are flagged stale (2 fetch intervals)
+#define NTP_SERVER "pool.ntp.org"       // Wall clock for timestamping persisted weather readings
 
 #endif // CONFIG_H
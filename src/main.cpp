@@ -1,7 +1,7 @@
 #include <M5Unified.h>
 #include "config.h"
 #include "WeatherStation.h"
-#include "WeatherStationData.h"
+#include "StationRegistry.h"
 #include "WiFiManager.h"
 #include "TemperatureSensor.h"
 #include "NeoPixelController.h"
@@ -10,6 +10,13 @@
 #include "AudioPlayer.h"
 #include "WebInterface.h"
 #include "SettingsManager.h"
+#include "StatusDisplay.h"
+#include "LatencyProbe.h"
+#include "WeatherCache.h"
+#include "CommandQueue.h"
+#include "SystemState.h"
+#include "HistoryLog.h"
+#include "OtaUpdater.h"
 
 // ============================================
 // DEBUG FLAGS - Set to true to enable testing
@@ -26,14 +33,10 @@
 // Global variables
 int glacierIndex = 0;      // Which glacier to display (0 or 1)
 
-// Station references for clarity
-WeatherStation& currentGlacierStation = stations[0];  // Can be changed via glacierIndex
-WeatherStation& localStation = stations[LOCAL_SHENZHEN];
-
 // Drop counter
 int dropCount = 0;
 
-// Setpoint mode: -1 = manual, 0-3 = linked to station index
+// Setpoint mode: -1 = manual, >= 0 = linked to station registry index
 int setpointMode = -1;  // Start in manual mode
 float manualSetpoint = MANUAL_SETPOINT;  // Current setpoint value
 
@@ -50,11 +53,26 @@ bool hwStatusWebServer = false;
 
 // Display update timing (non-blocking)
 unsigned long lastDisplayUpdate = 0;
-const unsigned long DISPLAY_UPDATE_INTERVAL = 500; // Update display every 500ms
+const unsigned long DISPLAY_UPDATE_INTERVAL = 50; // Check for changes every 50ms (redraws only when a value changed)
+
+// Forecast interpolation timing (station temperatures between fetches)
+unsigned long lastForecastInterpolation = 0;
+
+// LCD graph sampling (one column per GRAPH_SAMPLE_INTERVAL)
+unsigned long lastGraphSample = 0;
 
 // Temperature sensor timing (non-blocking)
 unsigned long lastTempRead = 0;
 float cachedPeltierTemperature = 20.0; // Cached temperature value
+bool temperatureReadOK = false;         // Sensor returned a valid reading (OTA health check)
+
+// Pending restart after /api/reset or a firmware update (0 = none)
+unsigned long restartAt = 0;
+
+// State published for other tasks (see SystemState.h)
+uint32_t loopIteration = 0;
+SystemState::Snapshot loopState;     // Filled and published by loop()
+SystemState::Snapshot displayState;  // Read back for the LCD
 
 // External references to system components
 extern SettingsManager settingsManager;
@@ -62,9 +80,16 @@ extern SettingsManager settingsManager;
 // Forward declarations
 void displayWeather(WeatherStation& station, int x, int y, int width, int height);
 void displayWeatherStations(float peltierTemperature);
-void displaySystemStatus(float peltierTemperature);
+void displaySystemStatus(const SystemState::Snapshot& state);
+void simulateDrop();
+void processCommands();
+void publishState();
+unsigned long endStage(int stage, unsigned long start);
 
 void setup() {
+  // Firmware update: count a trial boot, roll back a crash-looping update
+  // (first, so a crash anywhere later in setup() still counts)
+  otaUpdater.beginBoot();
 
    delay(2000); // Wait for system to stabilize (power surges, etc.)
 
@@ -73,6 +98,7 @@ void setup() {
   M5.begin(cfg);
   
   M5.Display.setRotation(1);
+  statusDisplay.begin();  // Off-screen sprite for flicker-free status screen
   M5.Display.setTextSize(1.2);
   M5.Display.fillScreen(BLACK);
   M5.Display.setTextColor(GREEN);
@@ -94,6 +120,25 @@ void setup() {
     M5.Display.setTextColor(GREEN);
   }
   
+  // Station registry (persisted, defaults from WeatherStationData.h on first boot)
+  stationRegistry.begin();
+  
+  // Restore last good weather readings (before WiFi, so a linked setpoint
+  // starts from real data instead of the presets)
+  weatherCache.load(stationRegistry.data(), stationRegistry.count());
+  
+  // Re-link the setpoint to the station it followed before the restart,
+  // starting from the cached reading (fresh weather updates it once WiFi is up)
+  if (stationRegistry.isValidIndex(settingsManager.currentSettings.setpointMode)) {
+    setpointMode = settingsManager.currentSettings.setpointMode;
+    stationRegistry.setLinkedIndex(setpointMode);
+    manualSetpoint = stationRegistry.at(setpointMode).temperature;
+    wifiManager.enable();  // Linked mode needs weather updates
+  }
+  
+  // Long-term history on LittleFS (served by /api/history)
+  historyLog.begin();
+  
   // Track hardware initialization status
   bool hardwareOK = true;
   
@@ -163,21 +208,17 @@ void setup() {
     M5.Display.print("4.WiFi.....");
     wifiManager.begin();
     if (wifiManager.isEnabled()) {
+      // Non-blocking: the connection completes in the background
       hwStatusWiFi = wifiManager.connect();
-      if (hwStatusWiFi) {
-        M5.Display.println("OK");
-        wifiManager.fetchWeather(stations, NUM_STATIONS);
-      } else {
-        M5.Display.setTextColor(YELLOW);
-        M5.Display.println("FAIL");
-        M5.Display.setTextColor(GREEN);
-      }
+      M5.Display.println(hwStatusWiFi ? "OK" : "BG");
     } else {
       hwStatusWiFi = false;
       M5.Display.setTextColor(YELLOW);
       M5.Display.println("DIS");
       M5.Display.setTextColor(GREEN);
     }
+    // Background weather fetcher (idles until WiFi is connected)
+    wifiManager.startWeatherTask();
   #else
     hwStatusWiFi = false;  // Not tested in debug mode
   #endif
@@ -212,6 +253,7 @@ void setup() {
   #if !GLOBAL_DEBUG
     M5.Display.setCursor(5, y); y += 12;
     M5.Display.print("7.WebServer...");
+    commandQueue.begin();  // Web handlers post commands from here on
     hwStatusWebServer = webInterface.begin(WEBSERVER_ENABLED);
     if (hwStatusWebServer) {
       M5.Display.println("OK");
@@ -246,7 +288,7 @@ void setup() {
   // PROGRAM INITIALIZATION
   // ==================================================
   
-  // Set thermostat setpoint to manual default (not linked to station yet)
+  // Set thermostat setpoint (manual, or the linked station's cached reading)
   thermostat.setSetPoint(manualSetpoint);
   
   // Set reactivate temperature from config
@@ -313,6 +355,18 @@ void setup() {
 
 void loop() {
   M5.update();
+  unsigned long stageStart = micros();
+  
+  // Commands posted by the web handlers (async TCP task) run here, so
+  // every component is only touched from loop()
+  processCommands();
+  settingsManager.update();  // Deferred settings save
+  if (restartAt != 0 && (long)(millis() - restartAt) >= 0) {
+    settingsManager.flush();
+    historyLog.flush();  // Records still buffered in RAM
+    ESP.restart();
+  }
+  stageStart = endStage(SystemState::STAGE_COMMANDS, stageStart);
   
   // ==================================================
   // MAIN PROGRAM FLOW
@@ -323,6 +377,8 @@ void loop() {
     // Read peltier/ice temperature from Dallas sensor (only every TEMP_READ_INTERVAL)
     if (millis() - lastTempRead >= TEMP_READ_INTERVAL) {
       cachedPeltierTemperature = tempSensor.readTemperature();
+      temperatureReadOK = tempSensor.isConnected() &&
+                          cachedPeltierTemperature != -127.0 && cachedPeltierTemperature != 85.0;
       lastTempRead = millis();
     }
     
@@ -335,68 +391,116 @@ void loop() {
     // Check for drop detection (update returns true when drop detected with debouncing)
     if (dropDetector.update()) {
       // Drop detected! 
+      int64_t edgeUs = dropDetector.getLastEdgeMicros();
+      latencyProbe.recordDetect(edgeUs);
       dropCount++; // Increment drop counter
       
       // 1. Trigger LED fade cycle (full white, then fade to black as it cools)
       neoPixels.onDropDetected(cachedPeltierTemperature, thermostat.getSetPoint());
+      latencyProbe.recordLed(edgeUs);
       
-      // 2. Play audio sample
-      audioPlayer.playDropSound();
+      // 2. Play audio sample (audio task records its UART write latency)
+      audioPlayer.playDropSound(edgeUs);
       
       // 3. Force peltier to reactivate immediately
       thermostat.forceActivate();
+      
+      // 4. Mark the drop on the LCD graph
+      statusDisplay.markDrop();
+    }
+    
+    // Append one column to the LCD temperature graph
+    if (millis() - lastGraphSample >= GRAPH_SAMPLE_INTERVAL) {
+      lastGraphSample = millis();
+      statusDisplay.addSample(cachedPeltierTemperature, thermostat.getSetPoint(), thermostat.getReactivateTemp());
     }
   }
   
+  stageStart = endStage(SystemState::STAGE_CONTROL, stageStart);
+  
   // Update LED brightness based on timer (always, even when paused)
   neoPixels.updateTimerFade();
   
   // Update ambient cube lighting (blue pulse when cooling, red glow when off)
   neoPixels.updateAmbientLight(thermostat.isCooling(), settingsManager.currentSettings.cubeLight, settingsManager.currentSettings.cubeLightBrightness);
+  stageStart = endStage(SystemState::STAGE_OUTPUTS, stageStart);
   
   // ==================================================
   // PERIODIC WIFI UPDATES
   // ==================================================
 
-  // Periodic WiFi reconnection attempt if enabled but not connected
-  if (wifiManager.shouldRetry()) {
-    wifiManager.connect();
+  // Advance the WiFi connection state machine (never blocks; retries use
+  // exponential backoff and trigger a weather fetch once connected)
+  wifiManager.update();
+  hwStatusWiFi = wifiManager.isConnected();
+  
+  // Apply the latest weather snapshot (fetched every few hours by the
+  // background weather task - never blocks here)
+  // The linked station is fetched even when it is not displayed
+  stationRegistry.setLinkedIndex(setpointMode);
+  WeatherStation* stations = stationRegistry.data();
+  int numStations = stationRegistry.count();
+  
+  bool weatherChanged = false;
+  if (wifiManager.applyLatestWeather(stations, numStations) > 0) {
+    // Warm start on next boot - one flash write per fetch round, and only
+    // when a station got a new reading
+    weatherCache.save(stations, numStations);
+    webInterface.notifyRefresh();  // Dashboards re-fetch the weather grid
+    weatherChanged = true;
   }
   
-  // Update weather every 5 minutes (only if WiFi connected)
-  if (wifiManager.shouldUpdate()) {
-    wifiManager.fetchWeather(stations, NUM_STATIONS);
-    // Update thermostat setpoint only if linked to a station
-    if (setpointMode >= 0 && setpointMode < NUM_STATIONS) {
-      manualSetpoint = stations[setpointMode].temperature;
-      thermostat.setSetPoint(manualSetpoint);
+  // Between fetches, interpolate station temperatures from the hourly
+  // forecast so a linked setpoint moves smoothly (also through outages)
+  if (weatherChanged || millis() - lastForecastInterpolation >= FORECAST_INTERPOLATE_INTERVAL) {
+    lastForecastInterpolation = millis();
+    uint32_t now = WeatherCache::nowEpoch();
+    if (now != 0) {
+      for (int i = 0; i < numStations; i++) {
+        float temperature;
+        if (forecastTemperature(stations[i], now, temperature)) {
+          stations[i].temperature = temperature;
+          weatherChanged = true;
+        }
+      }
     }
   }
   
+  // Update thermostat setpoint only if linked to a station
+  if (weatherChanged && stationRegistry.isValidIndex(setpointMode)) {
+    manualSetpoint = stations[setpointMode].temperature;
+    thermostat.setSetPoint(manualSetpoint);
+  }
+  stageStart = endStage(SystemState::STAGE_NETWORK, stageStart);
+  
+  // Publish this iteration's state (web task, display and dashboard pushes
+  // read consistent snapshots from here)
+  publishState();
+  historyLog.update(loopState);  // One averaged record per HISTORY_SAMPLE_INTERVAL
+  otaUpdater.checkHealth(temperatureReadOK, hwStatusWebServer, loopIteration);  // Trial boot after an update
+  stageStart = endStage(SystemState::STAGE_PUBLISH, stageStart);
+  
   // ==================================================
   // DISPLAY UPDATE
   // ==================================================
   
-  // Update display only periodically (non-blocking)
-  // Skip display updates during LED fade for smooth animation
-  if (millis() - lastDisplayUpdate >= DISPLAY_UPDATE_INTERVAL && !neoPixels.isFading()) {
+  // Update display periodically (non-blocking)
+  // Frames are rendered off-screen and pushed over DMA only when a value
+  // changed, so this no longer needs to pause during LED fades
+  if (millis() - lastDisplayUpdate >= DISPLAY_UPDATE_INTERVAL) {
     lastDisplayUpdate = millis();
-    displaySystemStatus(cachedPeltierTemperature);
+    systemState.read(displayState);
+    displaySystemStatus(displayState);
   }
+  stageStart = endStage(SystemState::STAGE_DISPLAY, stageStart);
+  
+  // Push changes (drops, thermostat transitions, temperatures) to dashboards
+  webInterface.pushUpdates();
+  endStage(SystemState::STAGE_PUSH, stageStart);
   
   // LCD button (BtnA - button under the display) simulates drop event
   if (M5.BtnA.wasPressed()) {
-    // Simulate drop detection!
-    dropCount++; // Increment drop counter
-    
-    // 1. Trigger LED fade cycle (full white, then fade to black as it cools)
-    neoPixels.onDropDetected(cachedPeltierTemperature, thermostat.getSetPoint());
-    
-    // 2. Play audio sample
-    audioPlayer.playDropSound();
-    
-    // 3. Force peltier to reactivate immediately
-    thermostat.forceActivate();
+    simulateDrop();
   }
   
   // COMMENTED: WiFi disable functionality
@@ -406,13 +510,424 @@ void loop() {
   // COMMENTED: Original glacier cycling functionality
   // Uncomment to cycle through glacier locations and update reference
   // if (M5.BtnA.wasPressed()) {
-  //   glacierIndex = (glacierIndex + 1) % (NUM_STATIONS - 1);
-  //   currentGlacierStation = stations[glacierIndex];
+  //   glacierIndex = (glacierIndex + 1) % stationRegistry.count();
   // }
   
   //delay(1000);
 }
 
+// Simulate drop detection (LCD button and /api/drop)
+void simulateDrop() {
+  dropCount++; // Increment drop counter
+  
+  // 1. Trigger LED fade cycle (full white, then fade to black as it cools)
+  neoPixels.onDropDetected(cachedPeltierTemperature, thermostat.getSetPoint());
+  
+  // 2. Play audio sample
+  audioPlayer.playDropSound();
+  
+  // 3. Force peltier to reactivate immediately
+  thermostat.forceActivate();
+  
+  // 4. Mark the drop on the LCD graph
+  statusDisplay.markDrop();
+}
+
+// Apply a parameter update (/api/update and /api/settings)
+// Returns the message for the reply.
+const char* applySettingsUpdate(const CommandQueue::SettingsUpdate& u) {
+  const char* message = "Parameters updated";
+  bool settingsChanged = false;
+  SettingsManager::Settings& settings = settingsManager.currentSettings;
+  
+  // Setpoint mode change (persisted - re-linked after a restart)
+  if (u.fields & CommandQueue::FIELD_SETPOINT_MODE) {
+    if (u.setpointMode == -1) {
+      // Switching to manual mode
+      if (u.fields & CommandQueue::FIELD_MANUAL_SETPOINT) {
+        manualSetpoint = u.manualSetpoint;
+        thermostat.setSetPoint(manualSetpoint);
+      }
+      setpointMode = -1;
+      settings.setpointMode = -1;
+      settingsChanged = true;
+      message = "Switched to manual mode";
+      
+    } else if (stationRegistry.isValidIndex(u.setpointMode)) {
+      // Switching to station-linked mode
+      setpointMode = u.setpointMode;
+      settings.setpointMode = setpointMode;
+      settingsChanged = true;
+      stationRegistry.setLinkedIndex(setpointMode);  // Fetched even if not displayed
+      
+      // Enable WiFi and start connecting (non-blocking). The setpoint starts
+      // from the current (cached) reading; fresh weather updates it later.
+      manualSetpoint = stationRegistry.at(setpointMode).temperature;
+      thermostat.setSetPoint(manualSetpoint);
+      if (!wifiManager.isConnected()) {
+        wifiManager.enable();  // Connection attempt starts in wifiManager.update()
+        message = "Linked to station, connecting to WiFi in the background";
+      } else {
+        // Already connected - refresh in the background
+        wifiManager.requestWeatherUpdate();
+        message = "Linked to station";
+      }
+    }
+  }
+  
+  // Update other parameters if provided
+  
+  if (u.fields & CommandQueue::FIELD_REACTIVATE_TEMP) {
+    thermostat.setReactivateTemp(u.reactivateTemp);
+    settings.reactivateTemp = u.reactivateTemp;
+    settingsChanged = true;
+  }
+  if (u.fields & CommandQueue::FIELD_MANUAL_SETPOINT) {
+    manualSetpoint = u.manualSetpoint;
+    settings.manualSetpoint = manualSetpoint;
+    // Update thermostat if in manual mode
+    if (setpointMode == -1) {
+      thermostat.setSetPoint(manualSetpoint);
+    }
+    settingsChanged = true;
+  }
+  if (u.fields & CommandQueue::FIELD_FREEZE_DURATION) {
+    settings.durationGlacierFreezing = u.freezeDuration;
+    settingsChanged = true;
+  }
+  if (u.fields & CommandQueue::FIELD_REACTIVATE_TIMER) {
+    settings.reactivateTimer = u.reactivateTimer;
+    settingsChanged = true;
+  }
+  if (u.fields & CommandQueue::FIELD_LED_FADE_TIME) {
+    settings.ledFadeTotalTime = u.ledFadeTime;
+    // TODO: Update NeoPixelController fade time if needed
+    settingsChanged = true;
+  }
+  if (u.fields & CommandQueue::FIELD_LED_BRIGHTNESS) {
+    settings.neopixelBrightness = u.ledBrightness;
+    // TODO: Update NeoPixelController brightness if needed
+    settingsChanged = true;
+  }
+  if (u.fields & CommandQueue::FIELD_CUBE_LIGHT) {
+    settings.cubeLight = u.cubeLight;
+    settingsChanged = true;
+  }
+  if (u.fields & CommandQueue::FIELD_CUBE_BRIGHTNESS) {
+    settings.cubeLightBrightness = u.cubeLightBrightness;
+    settingsChanged = true;
+  }
+  
+  // Save to EEPROM if any setting changed (once the changes stop coming in)
+  if (settingsChanged) {
+    settingsManager.requestSave();
+    Serial.println("Settings updated");
+    webInterface.notifyRefresh();  // Other dashboards pick up the new settings
+  }
+  
+  return message;
+}
+
+// Apply a validated change set from /api/settings - all fields or none
+// The web handler checked the ranges; the station index is checked again
+// here because the registry may have changed while the command was queued.
+// Fields that already hold the requested value are left out, so an
+// unchanged set does not rewrite the settings.
+void applySettingsBatch(const CommandQueue::SettingsUpdate& u, char* reply, size_t size) {
+  if ((u.fields & CommandQueue::FIELD_SETPOINT_MODE) &&
+      u.setpointMode != -1 && !stationRegistry.isValidIndex(u.setpointMode)) {
+    snprintf(reply, size, "{\"status\":\"error\",\"message\":\"Nothing applied\","
+             "\"fields\":{\"setpointMode\":\"unknown station\"}}");
+    return;
+  }
+  
+  const SettingsManager::Settings& settings = settingsManager.currentSettings;
+  uint16_t unchanged = 0;
+  if (u.setpointMode == setpointMode) unchanged |= CommandQueue::FIELD_SETPOINT_MODE;
+  if (u.manualSetpoint == manualSetpoint && u.manualSetpoint == settings.manualSetpoint) {
+    unchanged |= CommandQueue::FIELD_MANUAL_SETPOINT;
+  }
+  if (u.reactivateTemp == settings.reactivateTemp) unchanged |= CommandQueue::FIELD_REACTIVATE_TEMP;
+  if (u.freezeDuration == settings.durationGlacierFreezing) unchanged |= CommandQueue::FIELD_FREEZE_DURATION;
+  if (u.reactivateTimer == settings.reactivateTimer) unchanged |= CommandQueue::FIELD_REACTIVATE_TIMER;
+  if (u.ledFadeTime == settings.ledFadeTotalTime) unchanged |= CommandQueue::FIELD_LED_FADE_TIME;
+  if (u.ledBrightness == settings.neopixelBrightness) unchanged |= CommandQueue::FIELD_LED_BRIGHTNESS;
+  if (u.cubeLight == settings.cubeLight) unchanged |= CommandQueue::FIELD_CUBE_LIGHT;
+  if (u.cubeLightBrightness == settings.cubeLightBrightness) unchanged |= CommandQueue::FIELD_CUBE_BRIGHTNESS;
+  unchanged &= u.fields;
+  
+  CommandQueue::SettingsUpdate changes = u;
+  changes.fields &= ~unchanged;
+  const char* message = "No changes";
+  if (changes.fields != 0) {
+    message = applySettingsUpdate(changes);  // One save for the whole set
+  }
+  
+  int n = snprintf(reply, size, "{\"status\":\"ok\",\"message\":\"%s\",\"fields\":{", message);
+  const char* separator = "";
+  for (int i = 0; i < CommandQueue::NUM_UPDATE_FIELDS && n > 0 && (size_t)n < size; i++) {
+    uint16_t field = 1 << i;
+    if (!(u.fields & field)) continue;
+    n += snprintf(reply + n, size - n, "%s\"%s\":\"%s\"", separator,
+                  CommandQueue::fieldName(field), (unchanged & field) ? "unchanged" : "applied");
+    separator = ",";
+  }
+  if (n > 0 && (size_t)n < size) {
+    snprintf(reply + n, size - n, "}}");
+  }
+}
+
+// Add or update a station (/api/stations) - fields not given keep their value
+void upsertStation(const CommandQueue::StationUpdate& u, char* reply, size_t size) {
+  bool adding = (u.index < 0);
+  if (!adding && !stationRegistry.isValidIndex(u.index)) {
+    snprintf(reply, size, "{\"status\":\"error\",\"message\":\"Unknown station index\"}");
+    return;
+  }
+  
+  // Start from the current configuration when updating
+  WeatherStation s;
+  memset(&s, 0, sizeof(s));
+  strcpy(s.timezone, "auto");
+  s.priority = 1;
+  s.displayed = true;
+  bool hasLocation = false;
+  if (!adding) {
+    s = stationRegistry.at(u.index);
+    hasLocation = true;
+  }
+  
+  if (u.fields & CommandQueue::STATION_NAME) memcpy(s.name, u.name, sizeof(s.name));
+  if (u.fields & CommandQueue::STATION_TIMEZONE) memcpy(s.timezone, u.timezone, sizeof(s.timezone));
+  if (u.fields & CommandQueue::STATION_LOCATION) {
+    s.lat = u.lat;
+    s.lon = u.lon;
+    hasLocation = true;
+  }
+  if (u.fields & CommandQueue::STATION_INTERVAL) s.fetchInterval = u.fetchInterval;
+  if (u.fields & CommandQueue::STATION_PRIORITY) s.priority = u.priority;
+  if (u.fields & CommandQueue::STATION_DISPLAYED) s.displayed = u.displayed;
+  
+  if (s.name[0] == '\0' || !hasLocation) {
+    snprintf(reply, size, "{\"status\":\"error\",\"message\":\"Invalid station (name, lat/lon and interval >= 15 min required)\"}");
+    return;
+  }
+  
+  int index = stationRegistry.upsert(u.index, s.name, s.lat, s.lon, s.timezone,
+                                     s.fetchInterval, s.priority, s.displayed);
+  if (index < 0) {
+    snprintf(reply, size, "{\"status\":\"error\",\"message\":\"Station registry is full\"}");
+    return;
+  }
+  
+  if (u.fields & CommandQueue::STATION_LOCAL) {
+    if (u.local) {
+      stationRegistry.setLocalIndex(index);
+    } else if (stationRegistry.getLocalIndex() == index) {
+      stationRegistry.setLocalIndex(-1);
+    }
+  }
+  
+  stationRegistry.save();
+  wifiManager.requestWeatherUpdate(false);  // Fetch the station if it is now due
+  webInterface.notifyRefresh();
+  
+  snprintf(reply, size, "{\"status\":\"ok\",\"message\":\"%s\",\"index\":%d}",
+           adding ? "Station added" : "Station updated", index);
+}
+
+// Remove a station and keep a linked setpoint on the same station
+void deleteStation(int index, char* reply, size_t size) {
+  if (!stationRegistry.remove(index)) {
+    snprintf(reply, size, "{\"status\":\"error\",\"message\":\"Unknown station index\"}");
+    return;
+  }
+  
+  if (setpointMode == index) {
+    setpointMode = -1;  // Station gone - hold the current setpoint manually
+  } else if (setpointMode > index) {
+    setpointMode--;
+  }
+  stationRegistry.setLinkedIndex(setpointMode);
+  stationRegistry.save();
+  settingsManager.currentSettings.setpointMode = setpointMode;
+  settingsManager.requestSave();
+  webInterface.notifyRefresh();
+  
+  snprintf(reply, size, "{\"status\":\"ok\",\"message\":\"Station removed\"}");
+}
+
+// Execute one web command and write its JSON reply
+void executeCommand(const CommandQueue::Command& cmd, char* reply, size_t size) {
+  switch (cmd.type) {
+    case CommandQueue::CMD_DROP:
+      simulateDrop();
+      snprintf(reply, size, "{\"status\":\"ok\",\"message\":\"Drop triggered!\",\"dropCount\":%d}", dropCount);
+      break;
+      
+    case CommandQueue::CMD_TOGGLE_PELTIER:
+      if (thermostat.isCooling()) {
+        // Currently ON - turn it OFF
+        thermostat.turnOff();
+        snprintf(reply, size, "{\"status\":\"ok\",\"message\":\"Peltier turned OFF (will restart based on thermostat logic)\"}");
+      } else {
+        // Currently OFF - force it ON for 5 seconds
+        thermostat.forceActivate();
+        snprintf(reply, size, "{\"status\":\"ok\",\"message\":\"Peltier forced ON for 5 seconds\"}");
+      }
+      break;
+      
+    case CommandQueue::CMD_TEST_PELTIER:
+      // Force peltier ON for 5 seconds (thermostat will override after that)
+      thermostat.forceActivate();
+      snprintf(reply, size, "{\"status\":\"ok\",\"message\":\"Peltier forced ON for 5 seconds\"}");
+      break;
+      
+    case CommandQueue::CMD_TEST_LED:
+      // Set LEDs to full white (stay white until the next update or fade)
+      neoPixels.fill(255, 255, 255);
+      neoPixels.show();
+      snprintf(reply, size, "{\"status\":\"ok\",\"message\":\"LED test running (5 seconds)\"}");
+      break;
+      
+    case CommandQueue::CMD_TEST_AUDIO:
+      audioPlayer.playDropSound();
+      snprintf(reply, size, "{\"status\":\"ok\",\"message\":\"Audio playing\"}");
+      break;
+      
+    case CommandQueue::CMD_TOGGLE_SYSTEM:
+      systemRunning = !systemRunning;
+      snprintf(reply, size, "{\"status\":\"ok\",\"running\":%s,\"message\":\"%s\"}",
+               systemRunning ? "true" : "false", systemRunning ? "System RESUMED" : "System PAUSED");
+      break;
+      
+    case CommandQueue::CMD_RESET:
+      Serial.println("Resetting to defaults...");
+      settingsManager.resetToDefaults();
+      restartAt = millis() + RESTART_DELAY;  // Reply goes out first
+      snprintf(reply, size, "{\"status\":\"ok\",\"message\":\"Settings reset to defaults. Device will restart in 3 seconds...\"}");
+      break;
+      
+    case CommandQueue::CMD_UPDATE:
+      snprintf(reply, size, "{\"status\":\"ok\",\"message\":\"%s\"}", applySettingsUpdate(cmd.update));
+      break;
+      
+    case CommandQueue::CMD_UPDATE_BATCH:
+      applySettingsBatch(cmd.update, reply, size);
+      break;
+      
+    case CommandQueue::CMD_UPSERT_STATION:
+      upsertStation(cmd.station, reply, size);
+      break;
+      
+    case CommandQueue::CMD_DELETE_STATION:
+      deleteStation(cmd.arg, reply, size);
+      break;
+      
+    case CommandQueue::CMD_RESTART:
+      restartAt = millis() + RESTART_DELAY;  // Reply goes out first
+      snprintf(reply, size, "{\"status\":\"ok\",\"message\":\"Restarting\"}");
+      break;
+      
+    default:
+      snprintf(reply, size, "{\"status\":\"error\",\"message\":\"Unknown command\"}");
+      break;
+  }
+}
+
+// Drain the web command queue (bounded per loop iteration)
+void processCommands() {
+  CommandQueue::Command cmd;
+  char reply[COMMAND_REPLY_SIZE];
+  for (int i = 0; i < COMMAND_QUEUE_LENGTH && commandQueue.receive(cmd); i++) {
+    executeCommand(cmd, reply, sizeof(reply));
+    commandQueue.complete(cmd.id, reply);
+  }
+}
+
+// Add the time since start to a loop() stage (published with the state)
+// Returns the end time, which starts the next stage.
+unsigned long endStage(int stage, unsigned long start) {
+  unsigned long now = micros();
+  uint32_t elapsed = now - start;
+  loopState.stageUs[stage] += elapsed;
+  if (elapsed > loopState.stageMaxUs[stage]) {
+    loopState.stageMaxUs[stage] = elapsed;
+  }
+  return now;
+}
+
+// Copy the control state into one snapshot and publish it
+void publishState() {
+  SystemState::Snapshot& s = loopState;
+  s.iteration = ++loopIteration;
+  s.publishedAt = millis();
+  
+  s.cooling = thermostat.isCooling();
+  s.setpoint = thermostat.getSetPoint();
+  s.reactivateTemp = thermostat.getReactivateTemp();
+  s.coolingMs = thermostat.getCoolingMs();
+  s.transitions = thermostat.getTransitions();
+  
+  s.peltierTemp = cachedPeltierTemperature;
+  s.dropCount = dropCount;
+  s.setpointMode = setpointMode;
+  s.manualSetpoint = manualSetpoint;
+  s.systemRunning = systemRunning;
+  
+  s.hwTempSensor = hwStatusTempSensor;
+  s.hwDropDetector = hwStatusDropDetector;
+  s.hwNeoPixel = hwStatusNeoPixel;
+  s.hwAudioPlayer = hwStatusAudioPlayer;
+  s.hwWiFi = hwStatusWiFi;
+  s.hwWebServer = hwStatusWebServer;
+  
+  const SettingsManager::Settings& settings = settingsManager.currentSettings;
+  s.freezeDuration = settings.durationGlacierFreezing;
+  s.reactivateTimer = settings.reactivateTimer;
+  s.ledFadeTime = settings.ledFadeTotalTime;
+  s.ledBrightness = settings.neopixelBrightness;
+  s.cubeLight = settings.cubeLight;
+  s.cubeLightBrightness = settings.cubeLightBrightness;
+  
+  s.numStations = stationRegistry.count();
+  for (int i = 0; i < s.numStations; i++) {
+    const WeatherStation& station = stationRegistry.at(i);
+    SystemState::StationView& view = s.stations[i];
+    memcpy(view.name, station.name, sizeof(view.name));
+    view.temperature = station.temperature;
+    view.humidity = station.humidity;
+    view.ageSec = WeatherCache::ageSeconds(station);
+    view.stale = WeatherCache::isStale(station);
+    view.referenced = stationRegistry.isReferenced(i);
+  }
+  
+  // The web task reads these live; the fingerprints only version them
+  const WiFiManager::ConnStats& conn = wifiManager.getConnStats();
+  uint32_t stationIP = WiFi.localIP();
+  bool stationConnected = (WiFi.status() == WL_CONNECTED);
+  const char* wifiState = wifiManager.getStateName();
+  uint32_t hash = SystemState::fingerprint(&conn, sizeof(conn));
+  hash = SystemState::fingerprint(&stationIP, sizeof(stationIP), hash);
+  hash = SystemState::fingerprint(&stationConnected, sizeof(stationConnected), hash);
+  s.networkHash = SystemState::fingerprint(wifiState, strlen(wifiState), hash);
+  
+  const WiFiManager::HttpStats& http = wifiManager.getHttpStats();
+  const char* weatherHost = wifiManager.getWeatherHost();
+  uint16_t weatherPort = wifiManager.getWeatherPort();
+  hash = SystemState::fingerprint(&http, sizeof(http));
+  hash = SystemState::fingerprint(&weatherPort, sizeof(weatherPort), hash);
+  s.weatherClientHash = SystemState::fingerprint(weatherHost, strlen(weatherHost), hash);
+  
+  uint32_t history[] = {
+    historyLog.isMounted(), (uint32_t)historyLog.getSegmentCount(), historyLog.getRecordsWritten(),
+    historyLog.getWriteErrors(), historyLog.getSkippedNoClock()
+  };
+  s.historyHash = SystemState::fingerprint(history, sizeof(history));
+  
+  systemState.publish(s);
+}
+
 void displayWeather(WeatherStation& station, int x, int y, int width, int height) {
   // Draw rectangle border
   M5.Display.drawRect(x, y, width, height, WHITE);
@@ -452,10 +967,15 @@ void displayWeatherStations(float peltierTemperature) {
   M5.Display.fillScreen(BLACK);
   
   // Left 3/4 - Top half: Glacier (current selection)
-  displayWeather(currentGlacierStation, 0, 0, 96, 64);
+  if (stationRegistry.isValidIndex(glacierIndex)) {
+    displayWeather(stationRegistry.at(glacierIndex), 0, 0, 96, 64);
+  }
   
-  // Left 3/4 - Bottom half: Shenzhen
-  displayWeather(localStation, 0, 64, 96, 64);
+  // Left 3/4 - Bottom half: local station
+  int localIndex = stationRegistry.getLocalIndex();
+  if (stationRegistry.isValidIndex(localIndex)) {
+    displayWeather(stationRegistry.at(localIndex), 0, 64, 96, 64);
+  }
   
   // Right 1/4 - Peltier temperature display
   M5.Display.drawRect(96, 0, 32, 128, WHITE);
@@ -471,55 +991,16 @@ void displayWeatherStations(float peltierTemperature) {
   M5.Display.println("C");
 }
 
-void displaySystemStatus(float peltierTemperature) {
-  // NEW DISPLAY: System status information
-  
-  M5.Display.fillScreen(BLACK);
-  M5.Display.setTextSize(1.2);
-  
-  int y = 5;
-  
-  // Thermostat state
-  M5.Display.setCursor(5, y);
-  M5.Display.setTextColor(WHITE);
-  M5.Display.print("Thermostat: ");
-  if (thermostat.isCooling()) {
-    M5.Display.setTextColor(GREEN);
-    M5.Display.println("ON");
-  } else {
-    M5.Display.setTextColor(RED);
-    M5.Display.println("OFF");
-  }
-  y += 15;
-  
-  // Setpoint temperature
-  M5.Display.setCursor(5, y);
-  M5.Display.setTextColor(WHITE);
-  M5.Display.print("Setpoint: ");
-  M5.Display.setTextColor(CYAN);
-  M5.Display.printf("%.1f C", thermostat.getSetPoint());
-  y += 15;
-  
-  // Reactivate temperature
-  M5.Display.setCursor(5, y);
-  M5.Display.setTextColor(WHITE);
-  M5.Display.print("Reactivate: ");
-  M5.Display.setTextColor(ORANGE);
-  M5.Display.printf("%.1f C", thermostat.getReactivateTemp());
-  y += 20;
-  
-  // Peltier temperature
-  M5.Display.setCursor(5, y);
-  M5.Display.setTextColor(WHITE);
-  M5.Display.print("Peltier: ");
-  M5.Display.setTextColor(YELLOW);
-  M5.Display.printf("%.1f C", peltierTemperature);
-  y += 20;
-  
-  // Drop count
-  M5.Display.setCursor(5, y);
-  M5.Display.setTextColor(WHITE);
-  M5.Display.print("Drops: ");
-  M5.Display.setTextColor(MAGENTA);
-  M5.Display.printf("%d", dropCount);
+void displaySystemStatus(const SystemState::Snapshot& state) {
+  // NEW DISPLAY: System status header and scrolling temperature graph
+  // Rendered into an off-screen sprite, redrawn only when a value changed
+  
+  StatusDisplay::Frame frame;
+  frame.cooling = state.cooling;
+  frame.setpoint = state.setpoint;
+  frame.reactivateTemp = state.reactivateTemp;
+  frame.peltierTemp = state.peltierTemp;
+  frame.dropCount = state.dropCount;
+  
+  statusDisplay.update(frame);
 }
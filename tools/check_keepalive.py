@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Check that the firmware keeps its weather API connection alive.
+
+Runs against a device built for tools/mock_open_meteo.py (the
+m5stack-atoms3-mock environment) and the running mock server. For each body
+framing the mock can send (Content-Length, then chunked) it forces two
+weather fetches by linking the setpoint to a station and checks that:
+
+  - the second fetch was sent on the connection of the first one
+    (weatherClient.reusedRequests in /api/status went up, and the mock
+    counted a reused connection)
+  - the server never had to close the connection after a complete
+    response (weatherClient.closedAfterResponse unchanged)
+  - every fetch was parsed (no weatherClient.errors)
+
+The setpoint mode is restored afterwards. Exit status 1 if a check fails.
+
+    python3 tools/check_keepalive.py --device http://192.168.1.50 --mock http://192.168.1.10:8080
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import json
+import sys
+import time
+from urllib.parse import urlencode
+from urllib.request import Request, urlopen
+
+FETCH_TIMEOUT = 30  # seconds - wait for a fetch to show up in /api/status
+
+
+def get_json(url):
+    with urlopen(url, timeout=10) as response:
+        return json.load(response)
+
+
+def post_form(url, fields):
+    data = urlencode(fields).encode()
+    with urlopen(Request(url, data=data, method="POST"), timeout=10) as response:
+        return response.read()
+
+
+def weather_client(device):
+    return get_json(device + "/api/status?fields=weatherClient,setpointMode")
+
+
+def fetch_once(device, station):
+    """Link the setpoint to station (forces a fetch) and wait for the request."""
+    before = weather_client(device)["weatherClient"]["requests"]
+    post_form(device + "/api/update", {"setpointMode": station})
+    deadline = time.time() + FETCH_TIMEOUT
+    while time.time() < deadline:
+        time.sleep(0.5)
+        status = weather_client(device)
+        if status["weatherClient"]["requests"] > before:
+            time.sleep(0.5)  # Let the body be parsed and the request finish
+            return weather_client(device)["weatherClient"]
+    raise RuntimeError("no weather request within %d s - is the device using the mock?" % FETCH_TIMEOUT)
+
+
+def check_framing(device, mock, station, chunked):
+    name = "chunked" if chunked else "content-length"
+    get_json(mock + "/mock/reset")
+    get_json(mock + "/mock/config?" + urlencode({"chunked": "1" if chunked else "0"}))
+
+    first = fetch_once(device, station)
+    second = fetch_once(device, station)
+    mock_stats = get_json(mock + "/mock/stats")
+
+    failures = []
+    if second["reusedRequests"] <= first["reusedRequests"]:
+        failures.append("second fetch opened a new connection (reusedRequests %d -> %d)"
+                        % (first["reusedRequests"], second["reusedRequests"]))
+    if mock_stats["reusedRequests"] < 1:
+        failures.append("mock saw no request on a reused connection (%d connections)"
+                        % mock_stats["connections"])
+    if second["closedAfterResponse"] != first["closedAfterResponse"]:
+        failures.append("connection closed after a complete response")
+    if second["errors"] != first["errors"]:
+        failures.append("weather request failed (errors %d -> %d)" % (first["errors"], second["errors"]))
+
+    print("%-15s %s" % (name, "ok" if not failures else "FAILED"))
+    for failure in failures:
+        print("  - " + failure)
+    return not failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check weather API keep-alive against the mock server")
+    parser.add_argument("--device", required=True, help="device base URL, e.g. http://192.168.1.50")
+    parser.add_argument("--mock", required=True, help="mock server base URL, e.g. http://192.168.1.10:8080")
+    parser.add_argument("--station", type=int, default=0, help="station index to link for the fetches")
+    args = parser.parse_args()
+    device = args.device.rstrip("/")
+    mock = args.mock.rstrip("/")
+
+    original_mode = weather_client(device)["setpointMode"]
+    try:
+        ok = all([check_framing(device, mock, args.station, chunked) for chunked in (False, True)])
+    finally:
+        post_form(device + "/api/update", {"setpointMode": original_mode})
+        get_json(mock + "/mock/reset")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
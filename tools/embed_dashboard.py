@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""Compress web/index.html into src/DashboardHtml.h (gzip byte array in flash).
+
+Runs automatically before every PlatformIO build (extra_scripts in
+platformio.ini) and only rewrites the header when the page changed, so the
+firmware is not recompiled needlessly. Can also be run by hand:
+
+    python3 tools/embed_dashboard.py
+
+The gzip stream is built with a fixed timestamp, so the same page always
+produces the same bytes and the same ETag.
+"""
+
+import gzip
+import hashlib
+import os
+import sys
+
+HEADER_TEMPLATE = """\
+// GENERATED by tools/embed_dashboard.py from web/index.html - do not edit.
+// Edit web/index.html instead; the header is regenerated on every build.
+#ifndef DASHBOARD_HTML_H
+#define DASHBOARD_HTML_H
+
+#include <Arduino.h>
+
+// ETag of the compressed page (changes whenever web/index.html changes)
+#define DASHBOARD_ETAG "\\"{etag}\\""
+
+// Uncompressed size: {raw_len} bytes
+const size_t DASHBOARD_HTML_GZ_LEN = {gz_len};
+const uint8_t DASHBOARD_HTML_GZ[] PROGMEM = {{
+{data}
+}};
+
+#endif // DASHBOARD_HTML_H
+"""
+
+
+def render(html):
+    gz = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = hashlib.sha256(gz).hexdigest()[:16]
+    lines = []
+    for i in range(0, len(gz), 16):
+        chunk = gz[i:i + 16]
+        lines.append("  " + ", ".join("0x%02x" % b for b in chunk) + ",")
+    return HEADER_TEMPLATE.format(etag=etag, raw_len=len(html), gz_len=len(gz),
+                                  data="\n".join(lines)), len(gz)
+
+
+def embed(project_dir):
+    source = os.path.join(project_dir, "web", "index.html")
+    target = os.path.join(project_dir, "src", "DashboardHtml.h")
+
+    with open(source, "rb") as f:
+        html = f.read()
+    header, gz_len = render(html)
+
+    if os.path.exists(target):
+        with open(target, "r", encoding="utf-8") as f:
+            if f.read() == header:
+                return  # Up to date - keep the timestamp, avoid a rebuild
+
+    with open(target, "w", encoding="utf-8", newline="\n") as f:
+        f.write(header)
+    print("Dashboard: %d bytes -> %d bytes gzip (%s)" % (len(html), gz_len, target))
+
+
+try:
+    # Loaded by PlatformIO as a pre: extra script
+    Import("env")  # noqa: F821 - provided by SCons
+    embed(env["PROJECT_DIR"])  # noqa: F821
+except NameError:
+    # Run by hand
+    embed(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -0,0 +1,316 @@
+#!/usr/bin/env python3
+"""Local stand-in for the Open-Meteo forecast API.
+
+Serves /v1/forecast the way the firmware requests it (comma-separated
+latitude/longitude lists, current + hourly temperature, unixtime) so the
+weather pipeline can be exercised without the internet:
+
+  - synthetic responses: deterministic values derived from the coordinates
+    and the current hour (same request -> same body within an hour)
+  - recorded responses: --replay FILE serves a saved API body verbatim
+  - faults: latency/jitter, HTTP errors, truncated bodies, dropped
+    connections - set on the command line or at runtime via /mock/config
+  - framing: Content-Length (default) or chunked bodies, keep-alive on or
+    off; /mock/stats counts connections and requests that reused one
+
+Point the firmware at it by building with
+    -DWEATHER_API_BASE_URL=\\"http://<host-ip>:8080\\"
+(see the m5stack-atoms3-mock environment in platformio.ini).
+
+Runtime control (for test scripts):
+    GET /mock/config?latency_ms=500&status=503   update fault settings
+    GET /mock/config                              current settings
+    GET /mock/stats                               request counters
+    GET /mock/reset                               defaults + zero counters
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import json
+import math
+import random
+import socket
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+# Fault settings - all adjustable through /mock/config
+DEFAULTS = {
+    "latency_ms": 0,      # Delay before the response headers
+    "jitter_ms": 0,       # Extra random delay 0..jitter_ms
+    "status": 200,        # Forced HTTP status for /v1/forecast
+    "error_rate": 0.0,    # Probability of answering 503 instead
+    "truncate": -1,       # Send only this many body bytes, then close (-1 = off)
+    "drop_rate": 0.0,     # Probability of closing without any response
+    "keep_alive": True,   # Honour Connection: keep-alive
+    "chunked": False,     # Send forecast bodies with Transfer-Encoding: chunked
+    "chunk_size": 512,    # Body bytes per chunk
+}
+
+
+class MockState:
+    def __init__(self, settings, replay, seed):
+        self.lock = threading.Lock()
+        self.defaults = dict(settings)
+        self.settings = dict(settings)
+        self.replay = replay
+        self.random = random.Random(seed)
+        self.seed = seed
+        self.reset_stats()
+
+    def reset_stats(self):
+        self.stats = {
+            "requests": 0,
+            "forecastRequests": 0,
+            "locations": 0,
+            "errors": 0,
+            "truncated": 0,
+            "dropped": 0,
+            "connections": 0,
+            "reusedRequests": 0,  # Forecast requests on a connection that already served one
+        }
+
+    def count(self, key, n=1):
+        with self.lock:
+            self.stats[key] += n
+
+    def roll(self, probability):
+        with self.lock:
+            return probability > 0 and self.random.random() < probability
+
+    def update(self, query):
+        with self.lock:
+            for key, values in query.items():
+                if key not in self.settings:
+                    raise ValueError("unknown setting: " + key)
+                current = self.settings[key]
+                value = values[-1]
+                if isinstance(current, bool):
+                    self.settings[key] = value.lower() in ("1", "true", "yes", "on")
+                elif isinstance(current, float):
+                    self.settings[key] = float(value)
+                else:
+                    self.settings[key] = int(value)
+
+    def reset(self):
+        with self.lock:
+            self.settings = dict(self.defaults)
+            self.random = random.Random(self.seed)
+            self.reset_stats()
+
+
+def synthetic_location(lat, lon, forecast_hours, now):
+    """Plausible, deterministic weather for one location."""
+    hour = int(now // 3600) * 3600
+    # Colder towards the poles, daily cycle by local solar time
+    base = 28.0 - 0.45 * abs(lat)
+    phase = ((hour / 3600.0) + lon / 15.0) % 24.0
+
+    def temperature(t):
+        h = ((t / 3600.0) + lon / 15.0) % 24.0
+        return round(base + 5.0 * math.sin((h - 9.0) / 24.0 * 2.0 * math.pi), 1)
+
+    current_temp = temperature(now)
+    humidity = int(60 + 25 * math.cos(phase / 24.0 * 2.0 * math.pi))
+    dew_point = round(current_temp - (100 - humidity) / 5.0, 1)
+    times = [hour + i * 3600 for i in range(forecast_hours)]
+
+    return {
+        "latitude": lat,
+        "longitude": lon,
+        "generationtime_ms": 0.1,
+        "utc_offset_seconds": 0,
+        "timezone": "GMT",
+        "current_units": {"time": "unixtime", "interval": "seconds",
+                          "temperature_2m": "°C", "relative_humidity_2m": "%",
+                          "dew_point_2m": "°C"},
+        "current": {"time": int(now // 900) * 900, "interval": 900,
+                    "temperature_2m": current_temp,
+                    "relative_humidity_2m": humidity,
+                    "dew_point_2m": dew_point},
+        "hourly_units": {"time": "unixtime", "temperature_2m": "°C"},
+        "hourly": {"time": times,
+                   "temperature_2m": [temperature(t) for t in times]},
+    }
+
+
+def parse_list(query, key):
+    raw = query.get(key, [""])[-1]
+    return [float(v) for v in raw.split(",") if v.strip()]
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"  # Keep-alive like the real API
+    server_version = "mock-open-meteo/1.0"
+    state = None  # Set in main()
+    quiet = False
+
+    def setup(self):
+        super().setup()
+        self.state.count("connections")
+        self.served = 0  # Forecast requests answered on this connection
+
+    def log_message(self, fmt, *args):
+        if not self.quiet:
+            super().log_message(fmt, *args)
+
+    def send_body(self, status, body, faults=False):
+        settings = self.state.settings
+        chunked = faults and settings["chunked"]
+        self.send_response(status)
+        self.send_header("Content-Type", "application/json")
+        if chunked:
+            self.send_header("Transfer-Encoding", "chunked")
+        else:
+            self.send_header("Content-Length", str(len(body)))
+        if faults and not settings["keep_alive"]:
+            self.send_header("Connection", "close")
+            self.close_connection = True
+        self.end_headers()
+
+        truncate = settings["truncate"] if faults else -1
+        truncated = 0 <= truncate < len(body)
+        if truncated:
+            # The framing promises the full body - the client sees a short read
+            body = body[:truncate]
+
+        if chunked:
+            size = max(1, settings["chunk_size"])
+            for i in range(0, len(body), size):
+                chunk = body[i:i + size]
+                self.wfile.write(b"%x\r\n%s\r\n" % (len(chunk), chunk))
+            if not truncated:
+                self.wfile.write(b"0\r\n\r\n")
+        else:
+            self.wfile.write(body)
+
+        if truncated:
+            self.wfile.flush()
+            self.state.count("truncated")
+            self.close_connection = True
+
+    def send_json(self, status, obj, faults=False):
+        self.send_body(status, json.dumps(obj, separators=(",", ":")).encode(), faults)
+
+    def do_GET(self):
+        self.state.count("requests")
+        url = urlparse(self.path)
+        query = parse_qs(url.query)
+
+        if url.path == "/mock/config":
+            try:
+                self.state.update(query)
+            except ValueError as e:
+                self.send_json(400, {"error": True, "reason": str(e)})
+                return
+            self.send_json(200, self.state.settings)
+        elif url.path == "/mock/stats":
+            self.send_json(200, self.state.stats)
+        elif url.path == "/mock/reset":
+            self.state.reset()
+            self.send_json(200, self.state.settings)
+        elif url.path.endswith("/v1/forecast"):
+            self.forecast(query)
+        else:
+            self.send_json(404, {"error": True, "reason": "Not found"})
+
+    def forecast(self, query):
+        state = self.state
+        settings = state.settings
+        state.count("forecastRequests")
+        if self.served > 0:
+            state.count("reusedRequests")
+        self.served += 1
+
+        if state.roll(settings["drop_rate"]):
+            state.count("dropped")
+            self.close_connection = True
+            self.connection.shutdown(socket.SHUT_RDWR)
+            return
+
+        delay = settings["latency_ms"]
+        if settings["jitter_ms"] > 0:
+            with state.lock:
+                delay += state.random.randint(0, settings["jitter_ms"])
+        if delay > 0:
+            time.sleep(delay / 1000.0)
+
+        status = settings["status"]
+        if status == 200 and state.roll(settings["error_rate"]):
+            status = 503
+        if status != 200:
+            state.count("errors")
+            self.send_json(status, {"error": True, "reason": "Mocked error %d" % status}, True)
+            return
+
+        if state.replay is not None:
+            self.send_body(200, state.replay, True)
+            return
+
+        try:
+            lats = parse_list(query, "latitude")
+            lons = parse_list(query, "longitude")
+            hours = int(query.get("forecast_hours", ["48"])[-1])
+        except ValueError:
+            lats, lons, hours = [], [], 0
+        if not lats or len(lats) != len(lons) or hours <= 0:
+            state.count("errors")
+            self.send_json(400, {"error": True,
+                                 "reason": "latitude and longitude must have the same number of elements"}, True)
+            return
+
+        state.count("locations", len(lats))
+        now = time.time()
+        locations = [synthetic_location(lat, lon, hours, now) for lat, lon in zip(lats, lons)]
+        # Same shape as the real API: one location = object, several = array
+        self.send_json(200, locations[0] if len(locations) == 1 else locations, True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Mock Open-Meteo forecast server")
+    parser.add_argument("--host", default="0.0.0.0", help="bind address (default: all interfaces)")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--replay", metavar="FILE", help="serve this recorded API response for every forecast request")
+    parser.add_argument("--latency-ms", type=int, default=DEFAULTS["latency_ms"])
+    parser.add_argument("--jitter-ms", type=int, default=DEFAULTS["jitter_ms"])
+    parser.add_argument("--status", type=int, default=DEFAULTS["status"], help="force this HTTP status")
+    parser.add_argument("--error-rate", type=float, default=DEFAULTS["error_rate"], help="probability of a 503")
+    parser.add_argument("--truncate", type=int, default=DEFAULTS["truncate"], help="cut bodies after N bytes")
+    parser.add_argument("--drop-rate", type=float, default=DEFAULTS["drop_rate"], help="probability of closing without a response")
+    parser.add_argument("--no-keep-alive", action="store_true", help="close the connection after every response")
+    parser.add_argument("--chunked", action="store_true", help="send forecast bodies with Transfer-Encoding: chunked")
+    parser.add_argument("--seed", type=int, default=1, help="seed for error/drop/jitter decisions")
+    parser.add_argument("--quiet", action="store_true", help="do not log requests")
+    args = parser.parse_args()
+
+    settings = {
+        "latency_ms": args.latency_ms,
+        "jitter_ms": args.jitter_ms,
+        "status": args.status,
+        "error_rate": args.error_rate,
+        "truncate": args.truncate,
+        "drop_rate": args.drop_rate,
+        "keep_alive": not args.no_keep_alive,
+        "chunked": args.chunked,
+        "chunk_size": DEFAULTS["chunk_size"],
+    }
+    replay = None
+    if args.replay:
+        with open(args.replay, "rb") as f:
+            replay = f.read()
+
+    Handler.state = MockState(settings, replay, args.seed)
+    Handler.quiet = args.quiet
+    server = ThreadingHTTPServer((args.host, args.port), Handler)
+    print("Mock Open-Meteo listening on http://%s:%d" % (args.host, args.port))
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    server.server_close()
+
+
+if __name__ == "__main__":
+    main()